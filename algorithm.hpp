@@ -6,13 +6,20 @@
 /*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/19 11:22:35 by doreshev          #+#    #+#             */
-/*   Updated: 2022/10/27 20:01:19 by doreshev         ###   ########.fr       */
+/*   Updated: 2026/10/18 08:00:33 by doreshev         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef ALGORITHM_HPP
 # define ALGORITHM_HPP
 
+# include <memory>
+# include "iterators/iterator.hpp"
+# include "functional.hpp"
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
 namespace ft{
 	////EQUAL
 	template <class InputIterator1, class InputIterator2> 
@@ -66,12 +73,310 @@ namespace ft{
 		return (first1 == last1) && (first2 != last2);
 	}
 
+	////COPY
+	template <class InputIterator, class OutputIterator>
+	OutputIterator	copy(InputIterator first, InputIterator last, OutputIterator result)
+	{
+		for (; first != last; ++first, ++result)
+			*result = *first;
+		return result;
+	}
+
+	template <class BidirIterator1, class BidirIterator2>
+	BidirIterator2	copy_backward(BidirIterator1 first, BidirIterator1 last, BidirIterator2 result)
+	{
+		while (last != first)
+			*--result = *--last;
+		return result;
+	}
+
+# if __cplusplus >= 201103L
+	////MOVE
+	template <class InputIterator, class OutputIterator>
+	OutputIterator	move(InputIterator first, InputIterator last, OutputIterator result)
+	{
+		for (; first != last; ++first, ++result)
+			*result = std::move(*first);
+		return result;
+	}
+
+	template <class BidirIterator1, class BidirIterator2>
+	BidirIterator2	move_backward(BidirIterator1 first, BidirIterator1 last, BidirIterator2 result)
+	{
+		while (last != first)
+			*--result = std::move(*--last);
+		return result;
+	}
+
+# endif
+	////FILL
+	template <class ForwardIterator, class T>
+	void	fill(ForwardIterator first, ForwardIterator last, const T& val)
+	{
+		for (; first != last; ++first)
+			*first = val;
+	}
+
+	////LOWER / UPPER BOUND
+	// binary search over a sorted random access range
+	template <class RandomIterator, class T, class Compare>
+	RandomIterator	lower_bound(RandomIterator first, RandomIterator last, const T& val, Compare comp)
+	{
+		typename iterator_traits<RandomIterator>::difference_type	count = last - first;
+
+		while (count > 0)
+		{
+			typename iterator_traits<RandomIterator>::difference_type	half = count / 2;
+
+			if (comp(first[half], val)) {
+				first += half + 1;
+				count -= half + 1;
+			}
+			else
+				count = half;
+		}
+		return first;
+	}
+
+	template <class RandomIterator, class T, class Compare>
+	RandomIterator	upper_bound(RandomIterator first, RandomIterator last, const T& val, Compare comp)
+	{
+		typename iterator_traits<RandomIterator>::difference_type	count = last - first;
+
+		while (count > 0)
+		{
+			typename iterator_traits<RandomIterator>::difference_type	half = count / 2;
+
+			if (!comp(val, first[half])) {
+				first += half + 1;
+				count -= half + 1;
+			}
+			else
+				count = half;
+		}
+		return first;
+	}
+
+	////SET OPERATIONS
+	// On ranges sorted by comp, in one linear pass; equivalent elements are
+	// matched one for one, and the output takes them from the first range
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	set_union(InputIterator1 first1, InputIterator1 last1,
+							InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		for (; first1 != last1 && first2 != last2; ++result)
+		{
+			if (comp(*first2, *first1))
+				*result = *first2++;
+			else
+			{
+				if (!comp(*first1, *first2))
+					++first2;
+				*result = *first1++;
+			}
+		}
+		return ft::copy(first2, last2, ft::copy(first1, last1, result));
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_union(InputIterator1 first1, InputIterator1 last1,
+							InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return ft::set_union(first1, last1, first2, last2, result, ft::less<>());
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	set_intersection(InputIterator1 first1, InputIterator1 last1,
+							InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+				++first1;
+			else if (comp(*first2, *first1))
+				++first2;
+			else
+			{
+				*result = *first1++;
+				++result;
+				++first2;
+			}
+		}
+		return result;
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_intersection(InputIterator1 first1, InputIterator1 last1,
+							InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return ft::set_intersection(first1, last1, first2, last2, result, ft::less<>());
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	set_difference(InputIterator1 first1, InputIterator1 last1,
+							InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+			{
+				*result = *first1++;
+				++result;
+			}
+			else
+			{
+				if (!comp(*first2, *first1))
+					++first1;
+				++first2;
+			}
+		}
+		return ft::copy(first1, last1, result);
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_difference(InputIterator1 first1, InputIterator1 last1,
+							InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return ft::set_difference(first1, last1, first2, last2, result, ft::less<>());
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	set_symmetric_difference(InputIterator1 first1, InputIterator1 last1,
+							InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+			{
+				*result = *first1++;
+				++result;
+			}
+			else if (comp(*first2, *first1))
+			{
+				*result = *first2++;
+				++result;
+			}
+			else
+			{
+				++first1;
+				++first2;
+			}
+		}
+		return ft::copy(first2, last2, ft::copy(first1, last1, result));
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_symmetric_difference(InputIterator1 first1, InputIterator1 last1,
+							InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return ft::set_symmetric_difference(first1, last1, first2, last2, result, ft::less<>());
+	}
+
+	////STABLE SORT
+	// Merge sort: insertion-sorted runs of 16, then merge passes going back
+	// and forth between the range and a buffer holding a copy of it
+	template <class RandomIterator, class Compare>
+	void	_insertion_sort(RandomIterator first, RandomIterator last, Compare comp)
+	{
+		if (first == last)
+			return ;
+		for (RandomIterator it = first + 1; it != last; ++it)
+		{
+			typename iterator_traits<RandomIterator>::value_type	val = *it;
+			RandomIterator											hole = it;
+
+			for (; hole != first && comp(val, *(hole - 1)); --hole)
+				*hole = *(hole - 1);
+			*hole = val;
+		}
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	merge(InputIterator1 first1, InputIterator1 last1,
+						InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		for (; first1 != last1 && first2 != last2; ++result)
+		{
+			if (comp(*first2, *first1))
+				*result = *first2++;
+			else
+				*result = *first1++;
+		}
+		return ft::copy(first2, last2, ft::copy(first1, last1, result));
+	}
+
+	template <class From, class To, class Compare>
+	void	_merge_pass(From first, From last, To result, std::ptrdiff_t run, Compare comp)
+	{
+		while (last - first > run)
+		{
+			From	mid = first + run;
+			From	end = (last - mid > run) ? mid + run : last;
+
+			result = ft::merge(first, mid, mid, end, result, comp);
+			first = end;
+		}
+		ft::copy(first, last, result);
+	}
+
+	template <class RandomIterator, class Compare>
+	void	stable_sort(RandomIterator first, RandomIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomIterator>::value_type	value_type;
+		const std::ptrdiff_t	n = last - first;
+		std::ptrdiff_t			run = 16;
+
+		for (RandomIterator it = first; it != last; )
+		{
+			RandomIterator	end = (last - it > run) ? it + run : last;
+
+			ft::_insertion_sort(it, end, comp);
+			it = end;
+		}
+		if (n <= run)
+			return ;
+
+		std::allocator<value_type>	alloc;
+		value_type*					buf = alloc.allocate(n);
+		std::ptrdiff_t				built = 0;
+
+		try {
+			for (; built < n; ++built)
+				alloc.construct(buf + built, first[built]);
+			for (; run < n; run *= 4)
+			{
+				ft::_merge_pass(first, last, buf, run, comp);
+				if (run * 2 >= n) {
+					ft::copy(buf, buf + n, first);
+					break ;
+				}
+				ft::_merge_pass(buf, buf + n, first, run * 2, comp);
+			}
+		}
+		catch (...) {
+			for (std::ptrdiff_t i = 0; i < built; ++i)
+				alloc.destroy(buf + i);
+			alloc.deallocate(buf, n);
+			throw;
+		}
+		for (std::ptrdiff_t i = 0; i < n; ++i)
+			alloc.destroy(buf + i);
+		alloc.deallocate(buf, n);
+	}
+
 	template <class T> 
 	void	swap(T& x, T& y) {
+# if __cplusplus >= 201103L
+		T z = std::move(x);
+
+		x = std::move(y);
+		y = std::move(z);
+# else
 		T z = x;
 
 		x = y;
 		y = z;
+# endif
 	}
 
 }
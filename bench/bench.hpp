@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:16:42 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+# include <sys/time.h>
+# include <cstdlib>
+# include <iostream>
+# include "counting_allocator.hpp"
+
+namespace bench {
+	// Wall clock in nanoseconds
+	inline double	now_ns() {
+		struct timeval	tv;
+
+		gettimeofday(&tv, NULL);
+		return tv.tv_sec * 1e9 + tv.tv_usec * 1e3;
+	}
+	// Simple stopwatch: ns per operation since construction, along with
+	// the calls a counting_allocator made into stats over the same span
+	class timer {
+	public:
+		timer(const ft::allocation_stats& stats = ft::default_allocation_stats())
+			: _stats(&stats), _start(now_ns()), _allocations(stats.allocations), _bytes(stats.bytes) { }
+		void	reset() {
+			_allocations = _stats->allocations;
+			_bytes = _stats->bytes;
+			_start = now_ns();
+		}
+		double	elapsed_ns() const { return now_ns() - _start; }
+		double	per_op(std::size_t ops) const { return ops ? elapsed_ns() / ops : 0; }
+		double	allocations_per_op(std::size_t ops) const {
+			return ops ? static_cast<double>(_stats->allocations - _allocations) / ops : 0;
+		}
+		double	bytes_per_op(std::size_t ops) const {
+			return ops ? static_cast<double>(_stats->bytes - _bytes) / ops : 0;
+		}
+	private:
+		const ft::allocation_stats*	_stats;
+		double						_start;
+		std::size_t					_allocations;
+		std::size_t					_bytes;
+	};
+	// Keeps the optimizer from dropping benchmarked results
+	template <class T>
+	inline void	do_not_optimize(const T& val) {
+		static const void* volatile	sink;
+
+		sink = &val;
+		(void)sink;
+	}
+	// One result line: name, problem size, ns/op
+	inline void	report(const char* name, std::size_t n, double ns_per_op) {
+		std::cout << name << "\tn=" << n << "\t" << ns_per_op << " ns/op" << std::endl;
+	}
+	// and the allocations and bytes per op since t started, for containers
+	// on a counting_allocator; only the pool, btree and flat benches, which
+	// compare allocators and layouts of their own, report time alone
+	inline void	report(const char* name, std::size_t n, const timer& t, std::size_t ops) {
+		double	ns_per_op = t.per_op(ops);
+
+		std::cout << name << "\tn=" << n << "\t" << ns_per_op << " ns/op\t"
+			<< t.allocations_per_op(ops) << " allocs/op\t"
+			<< t.bytes_per_op(ops) << " bytes/op" << std::endl;
+	}
+}
+
+#endif
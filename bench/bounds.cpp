@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bounds.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:16:43 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+typedef ft::map<int, int, std::less<int>, ft::counting_allocator<ft::pair<const int, int> > >	map_type;
+
+// lower_bound / upper_bound / equal_range on growing maps:
+// time per query should grow with log(n), not n
+int main() {
+	const std::size_t	queries = 200000;
+	std::size_t			sizes[] = { 1000, 10000, 100000, 1000000 };
+
+	srand(42);
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		map_type	mp;
+		std::size_t	n = sizes[s];
+		long		sum = 0;
+
+		for (std::size_t i = 0; i < n; i++)
+			mp.insert(ft::make_pair(static_cast<int>(i * 2), static_cast<int>(i)));
+
+		bench::timer	t;
+		for (std::size_t i = 0; i < queries; i++)
+			sum += mp.lower_bound(rand() % (2 * n))->second;
+		bench::report("map::lower_bound", n, t, queries);
+
+		t.reset();
+		for (std::size_t i = 0; i < queries; i++) {
+			map_type::iterator it = mp.upper_bound(rand() % (2 * n - 1));
+			sum += it->second;
+		}
+		bench::report("map::upper_bound", n, t, queries);
+
+		t.reset();
+		for (std::size_t i = 0; i < queries; i++)
+			sum += mp.equal_range(rand() % (2 * n - 1)).second->second;
+		bench::report("map::equal_range", n, t, queries);
+		bench::do_not_optimize(sum);
+	}
+	return 0;
+}
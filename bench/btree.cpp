@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:30:13 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:31:45 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "btree_map.hpp"
+#include "vector.hpp"
+
+// ft::map against ft::btree_map on random insertion, lookups (half hits),
+// an in-order scan and erasing every key again; the B-tree gains the most
+// once the tree no longer fits in cache
+template <class Map>
+void	run(const char* name, const ft::vector<int>& keys) {
+	std::size_t		n = keys.size();
+	bench::timer	t;
+	Map				m;
+	long			sum = 0;
+
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+	bench::report(name, n, t.per_op(n));
+	t.reset();
+	for (std::size_t i = 0; i < n; i++)
+		sum += m.count(keys[(i * 7919) % n]) + m.count(rand());
+	bench::report("  find (half hits)", 2 * n, t.per_op(2 * n));
+	t.reset();
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	bench::report("  scan", n, t.per_op(n));
+	t.reset();
+	for (std::size_t i = 0; i < n; i++)
+		sum += m.erase(keys[i]);
+	bench::report("  erase", n, t.per_op(n));
+	bench::do_not_optimize(sum);
+}
+
+int main() {
+	std::size_t	sizes[] = { 1000, 100000, 1000000 };
+
+	srand(42);
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		ft::vector<int>	keys;
+
+		for (std::size_t i = 0; i < sizes[s]; i++)
+			keys.push_back(rand());
+		run<ft::map<int, int> >("map insert", keys);
+		run<ft::btree_map<int, int> >("btree_map insert", keys);
+	}
+	return 0;
+}
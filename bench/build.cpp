@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   build.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:41:30 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+
+typedef ft::map<int, int, std::less<int>, ft::counting_allocator<ft::pair<const int, int> > >	map_type;
+
+// Building a map from a sorted range: linear bulk construction (checked and
+// tagged) against one insertion per element
+int main() {
+	std::size_t	sizes[] = { 10000, 100000, 1000000, 4000000 };
+
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t								n = sizes[s];
+		ft::vector<ft::pair<const int, int> >	src;
+
+		src.reserve(n);
+		for (std::size_t i = 0; i < n; i++)
+			src.push_back(ft::pair<const int, int>(static_cast<int>(i) * 2, static_cast<int>(i)));
+
+		{
+			// warm-up so every variant below reuses already faulted-in heap pages
+			map_type	m(src.begin(), src.end());
+		}
+		bench::timer	t;
+		{
+			map_type	m(src.begin(), src.end());
+			bench::report("map range constructor, sorted", n, t, n);
+		}
+		t.reset();
+		{
+			map_type	m(ft::sorted_unique, src.begin(), src.end());
+			bench::report("map sorted_unique constructor", n, t, n);
+		}
+		t.reset();
+		{
+			map_type	m;
+			m.insert(src.begin(), src.end());
+			bench::report("map insert(first, last), sorted", n, t, n);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   copy.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:36:09 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+typedef ft::map<int, int, std::less<int>, ft::counting_allocator<ft::pair<const int, int> > >	map_type;
+
+// Copying a map: structural copy constructor against re-inserting every
+// element into an empty map (what the copy constructor used to do)
+int main() {
+	std::size_t	sizes[] = { 10000, 100000, 1000000, 4000000 };
+
+	srand(42);
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		map_type	src;
+		std::size_t	n = sizes[s];
+
+		while (src.size() < n)
+			src.insert(ft::make_pair(rand(), rand()));
+
+		bench::timer	t;
+		{
+			map_type	copy(src);
+			bench::report("map copy constructor", n, t, n);
+		}
+		t.reset();
+		{
+			map_type	copy;
+			copy.insert(src.begin(), src.end());
+			bench::report("map insert(first, last)", n, t, n);
+		}
+		t.reset();
+		{
+			map_type	copy;
+			copy[0] = 0;
+			copy = src;
+			bench::report("map operator=", n, t, n);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   empty.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:57:42 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "set.hpp"
+
+typedef ft::map<int, int, std::less<int>, ft::counting_allocator<ft::pair<const int, int> > >	map_type;
+typedef ft::set<int, std::less<int>, ft::counting_allocator<int> >	set_type;
+
+// Short-lived small containers: constructing, swapping and destroying
+// empty maps and sets, and maps holding a handful of elements
+int main() {
+	std::size_t	n = 1000000;
+
+	bench::timer	t;
+	for (std::size_t i = 0; i < n; i++) {
+		map_type	m;
+		bench::do_not_optimize(m);
+	}
+	bench::report("empty map construct + destroy", n, t, n);
+	t.reset();
+	for (std::size_t i = 0; i < n; i++) {
+		set_type	s;
+		bench::do_not_optimize(s);
+	}
+	bench::report("empty set construct + destroy", n, t, n);
+	t.reset();
+	for (std::size_t i = 0; i < n; i++) {
+		map_type	a;
+		map_type	b;
+		a.swap(b);
+		bench::do_not_optimize(a);
+	}
+	bench::report("empty map swap", n, t, n);
+	t.reset();
+	for (std::size_t i = 0; i < n; i++) {
+		map_type	m;
+		for (int k = 0; k < 4; k++)
+			m.insert(ft::make_pair(k, k));
+		bench::do_not_optimize(m);
+	}
+	bench::report("map of 4 elements", n, t, n);
+	return 0;
+}
@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   erase.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:48:10 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "set.hpp"
+
+typedef ft::set<int, std::less<int>, ft::counting_allocator<int> >	set_type;
+
+// Dropping a window of keys from the middle of a set: erasing each key
+// again by value, which is what erase(first, last) used to do, against
+// erase(first, last), for growing windows up to the whole set
+int main() {
+	std::size_t	n = 1000000;
+	std::size_t	parts[] = { 64, 8, 2, 1 };
+	set_type	src;
+
+	for (std::size_t i = 0; i < n; i++)
+		src.insert(std::rand());
+	n = src.size();
+	for (std::size_t p = 0; p < sizeof(parts) / sizeof(*parts); p++) {
+		std::size_t	k = n / parts[p];
+
+		std::cout << "window 1/" << parts[p] << std::endl;
+		{
+			set_type			s(src);
+			set_type::iterator	first = s.begin();
+
+			for (std::size_t i = 0; i < (n - k) / 2; i++)
+				++first;
+			set_type::iterator	last = first;
+
+			for (std::size_t i = 0; i < k; i++)
+				++last;
+			bench::timer	t;
+			while (first != last)
+				s.erase(*first++);
+			bench::report("set erase(key) loop", k, t, k);
+		}
+		{
+			set_type			s(src);
+			set_type::iterator	first = s.begin();
+
+			for (std::size_t i = 0; i < (n - k) / 2; i++)
+				++first;
+			set_type::iterator	last = first;
+
+			for (std::size_t i = 0; i < k; i++)
+				++last;
+			bench::timer	t;
+			s.erase(first, last);
+			bench::report("set erase(first, last)", k, t, k);
+		}
+	}
+	return 0;
+}
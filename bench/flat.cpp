@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:23:53 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:23:53 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "flat_map.hpp"
+#include "vector.hpp"
+
+// Read-mostly table: ft::map against ft::flat_map on building from an
+// unsorted range, random lookups, full iteration, and the bytes handed out
+// by the allocator for the elements (malloc headers not counted)
+template <class Map>
+void	run(const char* name, const ft::vector<ft::pair<int, int> >& src, std::size_t bytes) {
+	std::size_t		n = src.size();
+	bench::timer	t;
+	Map				m(src.begin(), src.end());
+	int				sum = 0;
+
+	bench::report(name, n, t.per_op(n));
+	t.reset();
+	for (std::size_t i = 0; i < n; i++)
+		sum += m.count(src[(i * 7919) % n].first) + m.count(rand());
+	bench::report("  find (half hits)", 2 * n, t.per_op(2 * n));
+	t.reset();
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	bench::report("  iterate", n, t.per_op(n));
+	std::cout << "  bytes/element\t" << static_cast<double>(bytes) / m.size() << std::endl;
+	bench::do_not_optimize(sum);
+}
+
+int main() {
+	std::size_t	sizes[] = { 1000, 100000, 1000000 };
+	typedef ft::flat_map<int, int>	flat;
+
+	srand(42);
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		ft::vector<ft::pair<int, int> >	src;
+
+		for (std::size_t i = 0; i < sizes[s]; i++)
+			src.push_back(ft::make_pair(rand(), rand()));
+		{
+			ft::map<int, int>	m(src.begin(), src.end());
+
+			run<ft::map<int, int> >("map range ctor", src, m.size() * sizeof(ft::Node<ft::map<int, int>::value_type>));
+		}
+		{
+			flat	m(src.begin(), src.end());
+
+			run<flat>("flat_map range ctor", src, m.keys().capacity() * sizeof(int) + m.values().capacity() * sizeof(int));
+		}
+	}
+	return 0;
+}
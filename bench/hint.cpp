@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hint.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:45:53 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+typedef ft::map<int, int, std::less<int>, ft::counting_allocator<ft::pair<const int, int> > >	map_type;
+
+// Appending increasing keys (timestamps) to a map: plain insert against
+// insert with end() or the previously inserted element as hint
+int main() {
+	std::size_t	sizes[] = { 10000, 100000, 1000000, 4000000 };
+
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t	n = sizes[s];
+		int			count = static_cast<int>(n);
+
+		{
+			// warm-up so every variant below reuses already faulted-in heap pages
+			map_type	m;
+			for (int i = 0; i < count; i++)
+				m.insert(m.end(), ft::make_pair(i, i));
+		}
+		bench::timer	t;
+		{
+			map_type	m;
+			for (int i = 0; i < count; i++)
+				m.insert(ft::make_pair(i, i));
+			bench::report("map insert(val), increasing", n, t, n);
+		}
+		t.reset();
+		{
+			map_type	m;
+			for (int i = 0; i < count; i++)
+				m.insert(m.end(), ft::make_pair(i, i));
+			bench::report("map insert(end(), val), increasing", n, t, n);
+		}
+		t.reset();
+		{
+			map_type			m;
+			map_type::iterator	last = m.end();
+			for (int i = 0; i < count; i++)
+				last = m.insert(last, ft::make_pair(i, i));
+			bench::report("map insert(last, val), increasing", n, t, n);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multimap.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:44:29 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "multimap.hpp"
+#include "vector.hpp"
+
+typedef ft::multimap<int, int, std::less<int>, ft::counting_allocator<ft::pair<const int, int> > >	multimap_type;
+typedef ft::vector<int, ft::counting_allocator<int> >	vector_type;
+
+// Several values per key: ft::multimap against the map<K, vector<V> >
+// it replaces, on insertion, counting the values of random keys and
+// visiting every value; n values over n / per_key keys. With few values
+// per key the vectors cost an allocation each on top of the map node
+void	run_multimap(std::size_t n, int per_key) {
+	multimap_type	m;
+	int				keys = static_cast<int>(n) / per_key;
+	bench::timer	t;
+	long			sum = 0;
+
+	srand(42);
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(ft::make_pair(rand() % keys, static_cast<int>(i)));
+	bench::report("multimap insert", n, t, n);
+	t.reset();
+	for (std::size_t i = 0; i < n; i++)
+		sum += m.count(rand() % keys);
+	bench::report("  count", n, t, n);
+	t.reset();
+	for (multimap_type::const_iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	bench::report("  iterate", n, t, n);
+	bench::do_not_optimize(sum);
+}
+
+void	run_map_of_vectors(std::size_t n, int per_key) {
+	typedef ft::map<int, vector_type, std::less<int>,
+		ft::counting_allocator<ft::pair<const int, vector_type> > >	map_type;
+	map_type		m;
+	int				keys = static_cast<int>(n) / per_key;
+	bench::timer	t;
+	long			sum = 0;
+
+	srand(42);
+	for (std::size_t i = 0; i < n; i++)
+		m[rand() % keys].push_back(static_cast<int>(i));
+	bench::report("map<int, vector<int> > insert", n, t, n);
+	t.reset();
+	for (std::size_t i = 0; i < n; i++) {
+		map_type::const_iterator	it = m.find(rand() % keys);
+
+		sum += it == m.end() ? 0 : it->second.size();
+	}
+	bench::report("  count", n, t, n);
+	t.reset();
+	for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+		for (vector_type::const_iterator v = it->second.begin(); v != it->second.end(); ++v)
+			sum += *v;
+	bench::report("  iterate", n, t, n);
+	bench::do_not_optimize(sum);
+}
+
+int main() {
+	std::size_t	sizes[] = { 1000, 100000, 1000000 };
+	int			per_key[] = { 2, 8 };
+
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++)
+		for (std::size_t p = 0; p < sizeof(per_key) / sizeof(*per_key); p++) {
+			std::cout << per_key[p] << " values per key" << std::endl;
+			run_map_of_vectors(sizes[s], per_key[p]);
+			run_multimap(sizes[s], per_key[p]);
+		}
+	return 0;
+}
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:01:08 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:01:08 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "pool_allocator.hpp"
+
+// Node layout: the main.cpp map workload (about a million random
+// insertions, then random key accesses). Built twice by make bench, as is
+// and through node_compact.cpp with FT_TREE_COMPACT_NODES
+template <class Map>
+void	run(const char* name, std::size_t n) {
+	Map				m;
+	bench::timer	t;
+	int				sum = 0;
+
+	srand(42);
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(ft::make_pair(rand(), rand()));
+	bench::report(name, n, t.per_op(n));
+	t.reset();
+	for (std::size_t i = 0; i < n; i++)
+		sum += m.count(rand());
+	bench::report("  find", n, t.per_op(n));
+	t.reset();
+	for (typename Map::iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	bench::report("  iterate", n, t.per_op(n));
+	bench::do_not_optimize(sum);
+}
+
+int main() {
+	std::size_t	n = 4294967296 / (4096 + sizeof(int));
+
+	std::cout << "sizeof(Node<pair<const int, int> >) = "
+		<< sizeof(ft::Node<ft::pair<const int, int> >) << std::endl;
+	run<ft::map<int, int> >("map<int, int> insert", n);
+	run<ft::map<int, int, std::less<int>, ft::pool_allocator<ft::pair<const int, int> > > >(
+		"map<int, int, pool_allocator> insert", n);
+	return 0;
+}
@@ -0,0 +1,17 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_compact.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:01:08 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:30:52 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// bench/node.cpp with the colour packed into the parent pointer
+#ifndef FT_TREE_COMPACT_NODES
+# define FT_TREE_COMPACT_NODES
+#endif
+#include "node.cpp"
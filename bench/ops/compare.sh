@@ -0,0 +1,25 @@
+#!/bin/sh
+# Runs every ft/std pair of operation benchmarks built by 'make bench' and
+# prints one tab separated line per operation:
+# operation, ops, ft ns/op, std ns/op, ft/std time ratio, then for ft and
+# std: allocations per op, bytes allocated per op and peak KiB held
+# usage: sh bench/ops/compare.sh [bench/ops/<operation>.ft.out ...]
+
+[ $# -eq 0 ] && set -- bench/ops/*.ft.out
+
+printf "op\tn\tft_ns\tstd_ns\tratio\tft_allocs\tstd_allocs\tft_bytes\tstd_bytes\tft_peak_kb\tstd_peak_kb\n"
+for ft in "$@"; do
+	std="${ft%.ft.out}.std.out"
+	if [ ! -x "$ft" ] || [ ! -x "$std" ]; then
+		echo "$ft or $std is missing, run make bench first" >&2
+		exit 1
+	fi
+	{ "$ft" && "$std"; } | awk -F '\t' '
+		$1 == "ft" { op = $2; n = $3; ft_ns = $4; ft_allocs = $5; ft_bytes = $6; ft_peak = $7 }
+		$1 == "std" { std_ns = $4; std_allocs = $5; std_bytes = $6; std_peak = $7 }
+		END {
+			ratio = (std_ns > 0) ? ft_ns / std_ns : 0
+			printf "%s\t%s\t%.2f\t%.2f\t%.3f\t%g\t%g\t%g\t%g\t%.0f\t%.0f\n", op, n, ft_ns, std_ns, ratio,
+				ft_allocs, std_allocs, ft_bytes, std_bytes, ft_peak / 1024, std_peak / 1024
+		}'
+done
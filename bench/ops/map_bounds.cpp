@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_bounds.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:27 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:14:19 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ops.hpp"
+
+// lower_bound and upper_bound of random keys, mostly absent from the map
+int main() {
+	std::size_t							n = 1000000;
+	TESTED_NAMESPACE::vector<int>		keys = ops::random_keys(2 * n);
+	ops::map							m;
+	long								sum = 0;
+
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(TESTED_NAMESPACE::make_pair(keys[i], 0));
+	ops::run							r("map_bounds", n);
+
+	r.start(m);
+	for (std::size_t i = n; i < 2 * n; i++)
+		sum += (m.lower_bound(keys[i]) == m.upper_bound(keys[i]));
+	r.report(m);
+	bench::do_not_optimize(sum);
+	return 0;
+}
@@ -0,0 +1,31 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_erase.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:27 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:14:19 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ops.hpp"
+
+// Erase every key of a map, in random order
+int main() {
+	std::size_t							n = 1000000;
+	TESTED_NAMESPACE::vector<int>		keys = ops::random_keys(n);
+	ops::map							m;
+
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(TESTED_NAMESPACE::make_pair(keys[i], 0));
+	ops::run							r("map_erase", n);
+
+	r.start(m);
+	for (std::size_t i = 0; i < n; i++)
+		m.erase(keys[i]);
+	r.report(m);
+	bench::do_not_optimize(m);
+	return 0;
+}
@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_find.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:27 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:14:19 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ops.hpp"
+
+// Find every key of a map, in random order
+int main() {
+	std::size_t							n = 1000000;
+	TESTED_NAMESPACE::vector<int>		keys = ops::random_keys(n);
+	ops::map							m;
+	std::size_t							found = 0;
+
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(TESTED_NAMESPACE::make_pair(keys[i], 0));
+	ops::run							r("map_find", n);
+
+	r.start(m);
+	for (std::size_t i = 0; i < n; i++)
+		found += m.find(keys[i]) != m.end();
+	r.report(m);
+	bench::do_not_optimize(found);
+	return 0;
+}
@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_insert.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:27 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:14:19 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ops.hpp"
+
+// Insert random keys into an empty map
+int main() {
+	std::size_t							n = 1000000;
+	TESTED_NAMESPACE::vector<int>		keys = ops::random_keys(n);
+	ops::map							m;
+	ops::run							r("map_insert", n);
+
+	r.start(m);
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(TESTED_NAMESPACE::make_pair(keys[i], 0));
+	r.report(m);
+	bench::do_not_optimize(m);
+	return 0;
+}
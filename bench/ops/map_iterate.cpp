@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_iterate.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:27 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:14:19 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ops.hpp"
+
+// Walk a map from begin() to end()
+int main() {
+	std::size_t							n = 1000000;
+	TESTED_NAMESPACE::vector<int>		keys = ops::random_keys(n);
+	ops::map							m;
+	long								sum = 0;
+
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(TESTED_NAMESPACE::make_pair(keys[i], 0));
+	ops::run							r("map_iterate", m.size());
+
+	r.start(m);
+	for (ops::map::const_iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->first;
+	r.report(m);
+	bench::do_not_optimize(sum);
+	return 0;
+}
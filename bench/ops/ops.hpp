@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ops.hpp                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:08 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:25:47 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef OPS_HPP
+# define OPS_HPP
+
+// One container operation per binary, built twice by the Makefile: against
+// ft, and against std with -DUSING_STD; bench/ops/compare.sh pairs the two
+// runs and prints the ft/std ratio
+# if !defined(USING_STD)
+#  define TESTED_NAMESPACE ft
+#  define TESTED_NAME "ft"
+#  include "vector.hpp"
+#  include "map.hpp"
+#  include "stack.hpp"
+#  include "deque.hpp"
+# else
+#  define TESTED_NAMESPACE std
+#  define TESTED_NAME "std"
+#  include <vector>
+#  include <map>
+#  include <stack>
+#  include <deque>
+# endif
+
+# include <cstdlib>
+# include <functional>
+# include "counting_allocator.hpp"
+# include "../bench.hpp"
+
+namespace ops {
+	// The measured containers: ft or std, all on a counting_allocator so both
+	// builds count allocations the same way, in ft::default_allocation_stats()
+	typedef ft::counting_allocator<int>											allocator;
+	typedef TESTED_NAMESPACE::vector<int, allocator>							vector;
+	typedef TESTED_NAMESPACE::map<int, int, std::less<int>,
+		ft::counting_allocator<TESTED_NAMESPACE::pair<const int, int> > >		map;
+# if !defined(USING_STD)
+	typedef ft::stack<int, ft::deque<int, allocator> >							stack;
+# else
+	typedef std::stack<int, std::deque<int, allocator> >						stack;
+# endif
+
+	// Keys in random order, drawn from a fixed seed so both builds get the
+	// same sequence
+	inline TESTED_NAMESPACE::vector<int>	random_keys(std::size_t n) {
+		TESTED_NAMESPACE::vector<int>	keys;
+
+		std::srand(42);
+		for (std::size_t i = 0; i < n; i++)
+			keys.push_back(std::rand());
+		return keys;
+	}
+	// Times ops calls of a measured section: start() before it, report() after
+	class run {
+	public:
+		run(const char* name, std::size_t ops) : _name(name), _ops(ops) { }
+		void	start() {
+			ft::default_allocation_stats().reset();
+			_timer.reset();
+		}
+		// One tab separated line: namespace, operation, ops, ns/op,
+		// allocations/op, bytes allocated/op, peak bytes held
+		void	report() const {
+			double					ns = _timer.per_op(_ops);
+			ft::allocation_stats&	stats = ft::default_allocation_stats();
+
+			std::cout << TESTED_NAME << "\t" << _name << "\t" << _ops << "\t" << ns << "\t"
+				<< static_cast<double>(stats.allocations) / _ops << "\t"
+				<< static_cast<double>(stats.bytes) / _ops << "\t"
+				<< stats.peak_bytes << std::endl;
+		}
+		// Same, for an operation on m: with FT_TREE_STATS (make bench_ops
+		// BENCH_FLAGS=-DFT_TREE_STATS) the ft build also dumps the shape and
+		// rebalancing work of its tree to stderr after the run
+		void	start(map& m) {
+# if defined(FT_TREE_STATS) && !defined(USING_STD)
+			m.reset_tree_statistics();
+# else
+			(void)m;
+# endif
+			start();
+		}
+		void	report(const map& m) const {
+			report();
+# if defined(FT_TREE_STATS) && !defined(USING_STD)
+			ft::tree_stats	st = m.tree_statistics();
+
+			std::cerr << _name << " tree: height " << st.height << ", black height "
+				<< st.black_height << ", average depth " << st.average_depth
+				<< ", rotations " << st.rotations << ", recolors " << st.recolors
+				<< ", erase fix-up loops " << st.del_rebalance_loops << std::endl;
+# else
+			(void)m;
+# endif
+		}
+	private:
+		const char*		_name;
+		std::size_t		_ops;
+		bench::timer	_timer;
+	};
+}
+
+#endif
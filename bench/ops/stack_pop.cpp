@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack_pop.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:27 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:10:09 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ops.hpp"
+
+// Pop a stack until it is empty
+int main() {
+	std::size_t						n = 1000000;
+	ops::stack						s;
+	long							sum = 0;
+
+	for (std::size_t i = 0; i < n; i++)
+		s.push(static_cast<int>(i));
+	ops::run						r("stack_pop", n);
+
+	r.start();
+	while (!s.empty()) {
+		sum += s.top();
+		s.pop();
+	}
+	r.report();
+	bench::do_not_optimize(sum);
+	return 0;
+}
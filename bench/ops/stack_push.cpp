@@ -0,0 +1,27 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack_push.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:27 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:10:09 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ops.hpp"
+
+// Push onto a stack over its default container
+int main() {
+	std::size_t						n = 1000000;
+	ops::stack						s;
+	ops::run						r("stack_push", n);
+
+	r.start();
+	for (std::size_t i = 0; i < n; i++)
+		s.push(static_cast<int>(i));
+	r.report();
+	bench::do_not_optimize(s);
+	return 0;
+}
@@ -0,0 +1,27 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_erase.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:27 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:10:09 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ops.hpp"
+
+// Erase one element from the middle until the vector is empty
+int main() {
+	std::size_t						n = 50000;
+	ops::vector						v(n, 1);
+	ops::run						r("vector_erase", n);
+
+	r.start();
+	while (!v.empty())
+		v.erase(v.begin() + v.size() / 2);
+	r.report();
+	bench::do_not_optimize(v);
+	return 0;
+}
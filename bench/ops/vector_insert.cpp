@@ -0,0 +1,27 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_insert.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:27 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:10:09 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ops.hpp"
+
+// Insert one element in the middle of a growing vector
+int main() {
+	std::size_t						n = 50000;
+	ops::vector						v;
+	ops::run						r("vector_insert", n);
+
+	r.start();
+	for (std::size_t i = 0; i < n; i++)
+		v.insert(v.begin() + v.size() / 2, static_cast<int>(i));
+	r.report();
+	bench::do_not_optimize(v);
+	return 0;
+}
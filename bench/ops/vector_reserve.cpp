@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_reserve.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:01:27 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:10:09 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ops.hpp"
+
+// reserve(n), then n push_back that never reallocate
+int main() {
+	std::size_t						n = 1000000;
+	ops::vector						v;
+	ops::run						r("vector_reserve", n);
+
+	r.start();
+	v.reserve(n);
+	for (std::size_t i = 0; i < n; i++)
+		v.push_back(static_cast<int>(i));
+	r.report();
+	bench::do_not_optimize(v);
+	return 0;
+}
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   order.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:38:51 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+typedef ft::map<int, int, std::less<int>, ft::counting_allocator<ft::pair<const int, int> > >	map_type;
+
+// Leaderboard queries: the k-th smallest key through begin() + k and the
+// number of keys below x through distance(begin(), lower_bound(x)), next
+// to the insertions and erasures that pay for the subtree sizes. Built
+// twice by make bench, as is (both queries walk the tree) and through
+// order_stats.cpp with FT_TREE_ORDER_STATISTICS (both are O(log n))
+void	run(std::size_t n, std::size_t queries) {
+	map_type		m;
+	bench::timer	t;
+	long			sum = 0;
+
+	srand(42);
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(ft::make_pair(rand(), rand()));
+	bench::report("insert", n, t, n);
+	t.reset();
+	for (std::size_t i = 0; i < queries; i++)
+		sum += (m.begin() + static_cast<std::ptrdiff_t>(rand() % m.size()))->second;
+	bench::report("  begin() + k", queries, t, queries);
+	t.reset();
+	for (std::size_t i = 0; i < queries; i++)
+		sum += ft::distance(m.begin(), m.lower_bound(rand()));
+	bench::report("  distance to lower_bound", queries, t, queries);
+	t.reset();
+	for (std::size_t i = 0; i < n; i++)
+		sum += m.erase(rand());
+	bench::report("  erase (random keys)", n, t, n);
+	bench::do_not_optimize(sum);
+}
+
+int main() {
+	run(1000, 10000);
+	run(100000, 1000);
+	run(1000000, 100);
+	return 0;
+}
@@ -0,0 +1,17 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   order_stats.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:38:51 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:30:52 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// bench/order.cpp with the subtree sizes of FT_TREE_ORDER_STATISTICS
+#ifndef FT_TREE_ORDER_STATISTICS
+# define FT_TREE_ORDER_STATISTICS
+#endif
+#include "order.cpp"
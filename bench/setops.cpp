@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   setops.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:59:18 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "set.hpp"
+
+typedef ft::set<int, std::less<int>, ft::counting_allocator<int> >	set_type;
+
+// Union and intersection of two sets sharing about half of their keys:
+// find/insert through one set per element of the other, against the set
+// overloads of ft::set_union and ft::set_intersection
+int main() {
+	std::size_t	sizes[] = { 10000, 100000, 1000000 };
+
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t	n = sizes[s];
+		int			range = static_cast<int>(n * 4 / 3);
+		set_type	a;
+		set_type	b;
+
+		while (a.size() < n)
+			a.insert(std::rand() % range);
+		while (b.size() < n)
+			b.insert(std::rand() % range);
+		bench::timer	t;
+		{
+			set_type	u(a);
+
+			for (set_type::const_iterator it = b.begin(); it != b.end(); ++it)
+				u.insert(*it);
+			bench::report("set union, copy + insert", n, t, n);
+			bench::do_not_optimize(u);
+		}
+		t.reset();
+		{
+			set_type	u = ft::set_union(a, b);
+
+			bench::report("set union, ft::set_union", n, t, n);
+			bench::do_not_optimize(u);
+		}
+		t.reset();
+		{
+			set_type	i;
+
+			for (set_type::const_iterator it = a.begin(); it != a.end(); ++it)
+				if (b.find(*it) != b.end())
+					i.insert(i.end(), *it);
+			bench::report("set intersection, find + insert", n, t, n);
+			bench::do_not_optimize(i);
+		}
+		t.reset();
+		{
+			set_type	i = ft::set_intersection(a, b);
+
+			bench::report("set intersection, ft::set_intersection", n, t, n);
+			bench::do_not_optimize(i);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   split.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:56:34 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+typedef ft::map<int, int, std::less<int>, ft::counting_allocator<ft::pair<const int, int> > >	map_type;
+
+// Moving the upper half of a map's keys to another map and back: element by
+// element (insert into the other map, then erase the range) against split
+// and join, which relink subtrees and only count the smaller half
+int main() {
+	std::size_t	sizes[] = { 10000, 100000, 1000000 };
+
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t	n = sizes[s];
+		int			count = static_cast<int>(n);
+		map_type	m;
+
+		for (int i = 0; i < count; i++)
+			m.insert(m.end(), ft::make_pair(i, i));
+		bench::timer	t;
+		{
+			map_type			right;
+			map_type::iterator	mid = m.lower_bound(count / 2);
+
+			right.insert(mid, m.end());
+			m.erase(mid, m.end());
+			m.insert(right.begin(), right.end());
+			right.clear();
+			bench::report("map insert + erase, there and back", n, t, 1);
+		}
+		t.reset();
+		{
+			map_type	right;
+
+			m.split(count / 2, right);
+			m.join(right);
+			bench::report("map split + join, there and back", n, t, 1);
+		}
+		t.reset();
+		{
+			map_type	right;
+
+			m.split(count - 10, right);
+			m.join(right);
+			bench::report("map split + join, last 10 keys", n, t, 1);
+		}
+		bench::do_not_optimize(m);
+	}
+	return 0;
+}
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:20:07 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "counting_allocator.hpp"
+#include "stack.hpp"
+#include "vector.hpp"
+#include "deque.hpp"
+
+// main.cpp's Buffer: 4 KiB payload per element
+struct Buffer {
+	int		idx;
+	char	buff[4096];
+};
+
+// Pushes n Buffers, then pops them all; reports ns per push / pop and the
+// most memory the container held at once
+template <class Container>
+void	run(const char* name, std::size_t n) {
+	ft::allocation_stats					stats;
+	ft::counting_allocator<Buffer>			alloc(stats);
+	ft::stack<Buffer, Container>			s((Container(alloc)));
+	Buffer									b;
+
+	b.idx = 0;
+	std::cout << name << std::endl;
+	bench::timer	t(stats);
+	for (std::size_t i = 0; i < n; i++) {
+		b.idx = static_cast<int>(i);
+		s.push(b);
+	}
+	bench::report("  push", n, t, n);
+	t.reset();
+	while (!s.empty())
+		s.pop();
+	bench::report("  pop", n, t, n);
+	std::cout << "  peak MiB\t" << stats.peak_bytes / (1024 * 1024)
+		<< "\tallocations " << stats.allocations << std::endl;
+}
+
+int main() {
+	std::size_t	n = 50000;
+
+	run<ft::vector<Buffer, ft::counting_allocator<Buffer> > >("stack over ft::vector", n);
+	run<ft::deque<Buffer, ft::counting_allocator<Buffer> > >("stack over ft::deque", n);
+	return 0;
+}
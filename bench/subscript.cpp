@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   subscript.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:11:02 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include <string>
+
+template <class T>
+struct map_of {
+	typedef ft::map<int, T, std::less<int>, ft::counting_allocator<ft::pair<const int, T> > >	type;
+};
+
+// operator[] as in main.cpp (sum += map_int[access]): random accesses
+// where about half of the keys are missing and get inserted
+template <class Map>
+void	run(const char* name, std::size_t n, const typename Map::mapped_type& val) {
+	Map				m;
+	bench::timer	t;
+	std::size_t		sum = 0;
+
+	srand(42);
+	for (std::size_t i = 0; i < n; i++)
+		m[rand() % (2 * n)] = val;
+	bench::report(name, n, t, n);
+	t.reset();
+	for (std::size_t i = 0; i < n; i++)
+		sum += m.count(rand() % (2 * n));
+	bench::report("  find (baseline)", n, t, n);
+	t.reset();
+	for (std::size_t i = 0; i < n; i++)
+		bench::do_not_optimize(m[rand() % (2 * n)]);
+	bench::report("  operator[]", n, t, n);
+	bench::do_not_optimize(sum);
+}
+
+int main() {
+	std::size_t	sizes[] = { 10000, 100000, 1000000 };
+
+	run<map_of<int>::type>("warm-up", sizes[2], 0);
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		run<map_of<int>::type>("map<int, int> fill", sizes[s], 1);
+		run<map_of<std::string>::type>("map<int, string> fill", sizes[s], std::string(32, 'x'));
+	}
+	return 0;
+}
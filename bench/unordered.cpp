@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:35:30 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:03:41 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "unordered_map.hpp"
+#include "vector.hpp"
+
+typedef ft::map<int, int, std::less<int>, ft::counting_allocator<ft::pair<const int, int> > >	map_type;
+typedef ft::unordered_map<int, int, ft::hash<int>, ft::equal_to<int>,
+	ft::counting_allocator<ft::pair<const int, int> > >	unordered_map_type;
+
+// The map workload of main.cpp: insert n random pairs, read 10000 random
+// keys through operator[] (nearly all of them missing, so inserted), then
+// copy the map; plus lookups with half hits and a full iteration
+template <class Map>
+void	run(const char* name, const ft::vector<int>& keys) {
+	std::size_t		n = keys.size();
+	bench::timer	t;
+	Map				m;
+	long			sum = 0;
+
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+	bench::report(name, n, t, n);
+	t.reset();
+	for (int i = 0; i < 10000; i++)
+		sum += m[rand()];
+	bench::report("  operator[] (random)", 10000, t, 10000);
+	t.reset();
+	for (std::size_t i = 0; i < n; i++)
+		sum += m.count(keys[(i * 7919) % n]) + m.count(rand());
+	bench::report("  find (half hits)", 2 * n, t, 2 * n);
+	t.reset();
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	bench::report("  iterate", m.size(), t, m.size());
+	t.reset();
+	{
+		Map	copy(m);
+
+		sum += copy.size();
+	}
+	bench::report("  copy", m.size(), t, m.size());
+	bench::do_not_optimize(sum);
+}
+
+int main() {
+	std::size_t	sizes[] = { 1000, 100000, 1000000 };
+
+	srand(42);
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		ft::vector<int>	keys;
+
+		for (std::size_t i = 0; i < sizes[s]; i++)
+			keys.push_back(rand());
+		run<map_type>("map insert", keys);
+		run<unordered_map_type>("unordered_map insert", keys);
+	}
+	return 0;
+}
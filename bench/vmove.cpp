@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vmove.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:06:21 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:30:08 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+#include "vector.hpp"
+#include <string>
+
+typedef ft::vector<std::string, ft::counting_allocator<std::string> >	vector_type;
+
+// Growing a vector of heap-backed strings. Built with STD=c++98 every
+// reallocation copies the strings; as C++11, the bench default, they are
+// moved (std::string's move constructor is noexcept)
+int main() {
+	std::size_t	sizes[] = { 10000, 100000, 1000000 };
+	std::string	val(32, 'x');
+
+	{
+		vector_type	warm(sizes[2], val);
+	}
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t		n = sizes[s];
+		bench::timer	t;
+		{
+			vector_type	v;
+			for (std::size_t i = 0; i < n; i++)
+				v.push_back(val);
+			bench::report("vector<string> push_back", n, t, n);
+		}
+		{
+			vector_type	v(n / 2, val);
+			t.reset();
+			v.reserve(n);
+			bench::report("vector<string> reserve", n / 2, t, n / 2);
+		}
+		if (n > 100000)
+			continue ;
+		t.reset();
+		{
+			vector_type	v;
+			for (std::size_t i = 0; i < n / 10; i++)
+				v.insert(v.begin() + v.size() / 2, val);
+			bench::report("vector<string> middle insert", n / 10, t, n / 10);
+		}
+	}
+	return 0;
+}
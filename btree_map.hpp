@@ -0,0 +1,274 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:27:18 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:31:45 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_MAP_HPP
+# define BTREE_MAP_HPP
+
+# include <stdexcept>
+# include "iterators/btree.hpp"
+
+namespace ft {
+// ft::map over a B-tree (iterators/btree.hpp): same interface, fewer cache
+// misses per lookup on large maps, but insertion and erasure invalidate
+// every iterator
+template<class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+class btree_map {
+public:
+	typedef	Key															key_type;
+	typedef	T															mapped_type;
+	typedef	Compare														key_compare;
+	typedef	typename ft::pair<const Key, T>								value_type;
+	typedef	Allocator													allocator_type;
+	typedef	typename allocator_type::reference							reference;
+	typedef	typename allocator_type::const_reference					const_reference;
+	typedef	typename allocator_type::pointer							pointer;
+	typedef	typename allocator_type::const_pointer						const_pointer;
+	typedef	typename allocator_type::size_type							size_type;
+	typedef typename allocator_type::difference_type					difference_type;
+
+	class value_compare
+	{
+	private:
+		friend class btree_map;
+	protected:
+		Compare				comp;
+		value_compare	(Compare c) : comp(c) {}
+	public:
+		typedef bool		result_type;
+		typedef value_type	first_argument_type;
+		typedef value_type	second_argument_type;
+
+		bool	operator() (const value_type& x, const value_type& y) const {
+			return comp(x.first, y.first);
+		}
+	};
+
+	typedef	ft::btree<key_type, value_type, ft::select_first<value_type>, key_compare, allocator_type>	tree;
+	typedef	typename tree::iterator									iterator;
+	typedef	typename tree::const_iterator							const_iterator;
+	typedef	typename tree::reverse_iterator							reverse_iterator;
+	typedef	typename tree::const_reverse_iterator					const_reverse_iterator;
+
+private:
+	key_compare				_comp;
+	allocator_type			_alloc;
+	tree					_tree;
+
+public:
+// MEMBER FUNCTIONS
+	// CONSTRUCTORS
+		// 1) Empty
+	explicit btree_map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+				: _comp(comp), _alloc(alloc), _tree(comp, alloc) { }
+		// 2) Range
+	template <class InputIterator>
+	btree_map (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _tree(comp, alloc) {
+		insert(first, last);
+	}
+		// 3) Copy
+	btree_map (const btree_map& x) : _comp(x._comp), _alloc(x._alloc), _tree(x._tree) { }
+	// DESTRUCTOR
+	~btree_map () { }
+	// ASSIGN OPERATOR
+	btree_map& operator= (const btree_map& x) {
+		_comp = x._comp;
+		_tree = x._tree;
+		return *this;
+	}
+	// ALLOCATOR GETTER -> Returns allocator
+	allocator_type get_allocator() const { return _alloc; }
+
+// ELEMENT ACCESS
+	// AT -> access specified element with bounds checking
+	mapped_type& at (const key_type& k) {
+		iterator	it = _tree.find(k);
+
+		if (it == end())
+			throw std::out_of_range("ft::btree_map::at");
+		return it->second;
+	}
+	const mapped_type& at (const key_type& k) const {
+		const_iterator	it = _tree.find(k);
+
+		if (it == end())
+			throw std::out_of_range("ft::btree_map::at");
+		return it->second;
+	}
+	// [] -> access or insert specified element
+	mapped_type& operator[] (const key_type& k) {
+		return try_emplace(k).first->second;
+	}
+// ITERATORS
+	iterator begin() { return _tree.begin(); }
+	const_iterator begin() const { return _tree.begin(); }
+	iterator end() { return _tree.end(); }
+	const_iterator end() const { return _tree.end(); }
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+// CAPACITY
+	bool empty() const { return _tree.empty(); }
+	size_type size() const { return _tree.size(); }
+	size_type max_size() const { return _tree.max_size(); }
+// MODIFIERS
+	// 1) Removes all elements
+	void clear() { _tree.clear(); }
+	// 2) Insertion of elements
+		// a) Single element
+	pair<iterator,bool> insert (const value_type& val) { return _tree.insert(val); }
+		// b) With hint: only end() is used, for sorted input
+	iterator insert (iterator position, const value_type& val) { return _tree.insert(position, val); }
+		// c) Range
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last) {
+		for (; first != last; ++first)
+			_tree.insert(end(), *first);
+	}
+		// d) Inserts k only when it is missing
+	pair<iterator,bool> try_emplace (const key_type& k) {
+		iterator	pos;
+
+		if (_tree.insert_pos(k, pos))
+			return ft::make_pair(pos, false);
+		return ft::make_pair(_tree.insert_at(pos, value_type(k, mapped_type())), true);
+	}
+	pair<iterator,bool> try_emplace (const key_type& k, const mapped_type& obj) {
+		iterator	pos;
+
+		if (_tree.insert_pos(k, pos))
+			return ft::make_pair(pos, false);
+		return ft::make_pair(_tree.insert_at(pos, value_type(k, obj)), true);
+	}
+		// e) Assigns obj to the element with key k, inserts it when missing
+	pair<iterator,bool> insert_or_assign (const key_type& k, const mapped_type& obj) {
+		pair<iterator,bool>	res = try_emplace(k, obj);
+
+		if (!res.second)
+			res.first->second = obj;
+		return res;
+	}
+	// 3) Erase -> Removes from container elements
+		// a) Removes element in given position
+	void erase (iterator position) { _tree.erase(position); }
+		// b) Removes element with given key
+	size_type erase (const key_type& k) { return _tree.erase_key(k); }
+		// c) Removes elemets in given range: every erasure moves values
+		//    around, so the next one is looked up again by key
+	void erase (iterator first, iterator last) {
+		size_type	n = 0;
+
+		if (first == begin() && last == end())
+			return clear();
+		for (iterator it = first; it != last; ++it)
+			n++;
+		while (n--) {
+			key_type	k = first->first;
+
+			_tree.erase(first);
+			first = _tree.lower_bound(k);
+		}
+	}
+	// 4) Swap -> Exchanges the content of the container by the content of x
+	void swap (btree_map& x) {
+		_tree.swap(x._tree);
+		ft::swap(_comp, x._comp);
+		ft::swap(_alloc, x._alloc);
+	}
+// LOOKUP (Operations)
+	//    Every lookup also has a template overload taking any K the comparator
+	//    accepts, enabled when key_compare is transparent (e.g. ft::less<>)
+	// 1) Count -> Count elements with a specific key
+	size_type count (const key_type& k) const { return _tree.count(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type
+		count (const K& k) const { return _tree.count(k); }
+	// 2) Find -> finds element with specific key
+	iterator find (const key_type& k) { return _tree.find(k); }
+	const_iterator find (const key_type& k) const { return _tree.find(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		find (const K& k) { return _tree.find(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		find (const K& k) const { return _tree.find(k); }
+	// 3) Get range of equal elements
+	pair<iterator,iterator> equal_range (const key_type& k) {
+		return ft::make_pair(lower_bound(k), upper_bound(k));
+	}
+	pair<const_iterator,const_iterator> equal_range (const key_type& k) const {
+		return ft::make_pair(lower_bound(k), upper_bound(k));
+	}
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<iterator,iterator> >::type
+		equal_range (const K& k) { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<const_iterator,const_iterator> >::type
+		equal_range (const K& k) const { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+	// 4) Return iterator to lower bound
+	iterator lower_bound (const key_type& k) { return _tree.lower_bound(k); }
+	const_iterator lower_bound (const key_type& k) const { return _tree.lower_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		lower_bound (const K& k) { return _tree.lower_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		lower_bound (const K& k) const { return _tree.lower_bound(k); }
+	// 5) Return iterator to upper bound
+	iterator upper_bound (const key_type& k) { return _tree.upper_bound(k); }
+	const_iterator upper_bound (const key_type& k) const { return _tree.upper_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		upper_bound (const K& k) { return _tree.upper_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		upper_bound (const K& k) const { return _tree.upper_bound(k); }
+// OBSERVERS
+	key_compare key_comp() const { return _comp; }
+	value_compare value_comp() const { return value_compare(_comp); }
+};
+
+// RELATIONAL OPERATORS BTREE MAP
+template< class Key, class T, class Compare, class Alloc >
+bool operator==( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs ) {
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator!= ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ) {
+	return !(lhs == rhs);
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator< ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ) {
+	return ft::lexicographical_compare (lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator<= ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ) {
+	return 	!(rhs < lhs);
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator>  ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ) {
+	return rhs < lhs;
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator>= ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ) {
+	return 	!(lhs < rhs);
+}
+//SWAP
+template <class Key, class T, class Compare, class Alloc>
+void swap (btree_map<Key,T,Compare,Alloc>& lhs, btree_map<Key,T,Compare,Alloc>& rhs) { lhs.swap(rhs); }
+
+}
+
+#endif
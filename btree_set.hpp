@@ -0,0 +1,194 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_set.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:28:31 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:31:45 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_SET_HPP
+# define BTREE_SET_HPP
+
+# include "iterators/btree.hpp"
+
+namespace ft {
+// ft::set over a B-tree (iterators/btree.hpp): insertion and erasure
+// invalidate every iterator
+template< class Key, class Compare = std::less<Key>, class Allocator = std::allocator<Key> >
+class btree_set {
+public:
+	typedef	Key															key_type;
+	typedef	Key															value_type;
+	typedef	Compare														key_compare;
+	typedef	Compare														value_compare;
+	typedef	Allocator													allocator_type;
+	typedef	typename allocator_type::reference							reference;
+	typedef	typename allocator_type::const_reference					const_reference;
+	typedef	typename allocator_type::pointer							pointer;
+	typedef	typename allocator_type::const_pointer						const_pointer;
+	typedef typename allocator_type::difference_type					difference_type;
+	typedef	typename allocator_type::size_type							size_type;
+
+	typedef	ft::btree<key_type, value_type, ft::identity<value_type>, key_compare, allocator_type>	tree;
+	typedef	typename tree::const_iterator								iterator;
+	typedef	typename tree::const_iterator								const_iterator;
+	typedef	typename tree::const_reverse_iterator						reverse_iterator;
+	typedef	typename tree::const_reverse_iterator						const_reverse_iterator;
+
+private:
+	key_compare				_comp;
+	allocator_type			_alloc;
+	tree					_tree;
+
+public:
+// MEMBER FUNCTIONS
+	// CONSTRUCTORS
+		// 1) Empty
+	explicit btree_set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+				: _comp(comp), _alloc(alloc), _tree(comp, alloc) { }
+		// 2) Range
+	template <class InputIterator>
+	btree_set (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _tree(comp, alloc) {
+		insert(first, last);
+	}
+		// 3) Copy
+	btree_set (const btree_set& x) : _comp(x._comp), _alloc(x._alloc), _tree(x._tree) { }
+	// DESTRUCTOR
+	~btree_set () { }
+	// ASSIGN OPERATOR
+	btree_set& operator= (const btree_set& x) {
+		_comp = x._comp;
+		_tree = x._tree;
+		return *this;
+	}
+	// ALLOCATOR GETTER -> Returns allocator
+	allocator_type get_allocator() const { return _alloc; }
+
+// ITERATORS
+	iterator begin() const { return _tree.begin(); }
+	iterator end() const { return _tree.end(); }
+	reverse_iterator rbegin() const { return reverse_iterator(end()); }
+	reverse_iterator rend() const { return reverse_iterator(begin()); }
+// CAPACITY
+	bool empty() const { return _tree.empty(); }
+	size_type size() const { return _tree.size(); }
+	size_type max_size() const { return _tree.max_size(); }
+// MODIFIERS
+	// 1) Removes all elements
+	void clear() { _tree.clear(); }
+	// 2) Insertion of elements
+		// a) Single element
+	pair<iterator,bool> insert (const value_type& val) {
+		pair<typename tree::iterator,bool>	res = _tree.insert(val);
+
+		return ft::make_pair(iterator(res.first), res.second);
+	}
+		// b) With hint: only end() is used, for sorted input
+	iterator insert (iterator position, const value_type& val) { return _tree.insert(position, val); }
+		// c) Range
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last) {
+		for (; first != last; ++first)
+			_tree.insert(end(), *first);
+	}
+	// 3) Erase -> Removes from container elements
+		// a) Removes element in given position
+	void erase (iterator position) { _tree.erase(position); }
+		// b) Removes element with given key
+	size_type erase (const key_type& k) { return _tree.erase_key(k); }
+		// c) Removes elemets in given range: every erasure moves values
+		//    around, so the next one is looked up again by key
+	void erase (iterator first, iterator last) {
+		size_type	n = 0;
+
+		if (first == begin() && last == end())
+			return clear();
+		for (iterator it = first; it != last; ++it)
+			n++;
+		while (n--) {
+			key_type	k = *first;
+
+			_tree.erase(first);
+			first = _tree.lower_bound(k);
+		}
+	}
+	// 4) Swap -> Exchanges the content of the container by the content of x
+	void swap (btree_set& x) {
+		_tree.swap(x._tree);
+		ft::swap(_comp, x._comp);
+		ft::swap(_alloc, x._alloc);
+	}
+// LOOKUP (Operations)
+	//    Every lookup also has a template overload taking any K the comparator
+	//    accepts, enabled when key_compare is transparent (e.g. ft::less<>)
+	// 1) Count -> Count elements with a specific key
+	size_type count (const key_type& k) const { return _tree.count(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type
+		count (const K& k) const { return _tree.count(k); }
+	// 2) Find -> finds element with specific key
+	iterator find (const key_type& k) const { return _tree.find(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		find (const K& k) const { return _tree.find(k); }
+	// 3) Get range of equal elements
+	pair<iterator,iterator> equal_range (const key_type& k) const {
+		return ft::make_pair(lower_bound(k), upper_bound(k));
+	}
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<iterator,iterator> >::type
+		equal_range (const K& k) const { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+	// 4) Return iterator to lower bound
+	iterator lower_bound (const key_type& k) const { return _tree.lower_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		lower_bound (const K& k) const { return _tree.lower_bound(k); }
+	// 5) Return iterator to upper bound
+	iterator upper_bound (const key_type& k) const { return _tree.upper_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		upper_bound (const K& k) const { return _tree.upper_bound(k); }
+// OBSERVERS
+	key_compare key_comp() const { return _comp; }
+	value_compare value_comp() const { return _comp; }
+};
+
+// RELATIONAL OPERATORS BTREE SET
+template< class Key, class Compare, class Alloc >
+bool operator==( const ft::btree_set<Key,Compare,Alloc>& lhs, const ft::btree_set<Key,Compare,Alloc>& rhs ) {
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+template< class Key, class Compare, class Alloc >
+bool operator!= ( const btree_set<Key,Compare,Alloc>& lhs, const btree_set<Key,Compare,Alloc>& rhs ) {
+	return !(lhs == rhs);
+}
+template< class Key, class Compare, class Alloc >
+bool operator< ( const btree_set<Key,Compare,Alloc>& lhs, const btree_set<Key,Compare,Alloc>& rhs ) {
+	return ft::lexicographical_compare (lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+template< class Key, class Compare, class Alloc >
+bool operator<= ( const btree_set<Key,Compare,Alloc>& lhs, const btree_set<Key,Compare,Alloc>& rhs ) {
+	return 	!(rhs < lhs);
+}
+template< class Key, class Compare, class Alloc >
+bool operator>  ( const btree_set<Key,Compare,Alloc>& lhs, const btree_set<Key,Compare,Alloc>& rhs ) {
+	return rhs < lhs;
+}
+template< class Key, class Compare, class Alloc >
+bool operator>= ( const btree_set<Key,Compare,Alloc>& lhs, const btree_set<Key,Compare,Alloc>& rhs ) {
+	return 	!(lhs < rhs);
+}
+//SWAP
+template< class Key, class Compare, class Alloc >
+void swap (btree_set<Key,Compare,Alloc>& lhs, btree_set<Key,Compare,Alloc>& rhs) { lhs.swap(rhs); }
+
+}
+
+#endif
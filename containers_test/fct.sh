@@ -20,6 +20,19 @@ CFLAGS="-Wall -Wextra -Werror -std=c++98"
 ft_compile_output="/dev/null"
 std_compile_output="/dev/null"
 
+# Timing mode (main --perf): ft and std binaries run one after the other
+# through measure.out, a test fails when ft needs more than perf_factor
+# times the CPU time (user + sys) or the peak RSS of std; values under the
+# floors are compared as the floors, so that noise on tiny tests is ignored
+perf_mode=0
+perf_factor="${PERF_FACTOR:-3}"
+perf_min_ms="${PERF_MIN_MS:-50}"
+perf_min_kb="${PERF_MIN_KB:-8192}"
+measure_bin="./measure.out"
+
+# Number of tests with an error, main returns non zero when there is any
+failures=0
+
 function pheader () {
 printf "${EOC}${BOLD}${DBLUE}\
 # ****************************************************************************** #
@@ -69,13 +82,19 @@ getYN () {
 }
 
 printRes () {
-	# 1=file 2=compile 3=bin 4=output 5=std_compile
-	printf "%-35s: COMPILE: %s | RET: %s | OUT: %s | STD: [%s]\n" \
+	# 1=file 2=compile 3=bin 4=output 5=std_compile 6?=perf 7?=perf_summary
+	printf "%-35s: COMPILE: %s | RET: %s | OUT: %s | STD: [%s]" \
 		"$1" "$(getEmoji $2)" "$(getEmoji $3)" "$(getEmoji $4)" "$(getYN $5)"
+	if [ -n "$6" ]; then
+		printf " | PERF: %s %s" "$(getEmoji $6)" "$7"
+	fi
+	printf "\n"
 }
 
 # If diff_file empty, return 0 -> ok
-# If diff is about max_size, return 2 -> warning
+# If diff is about max_size, or the what() message the runtime prints for
+# an uncaught exception (its text depends on the standard library), return 2
+# -> warning
 # Else, diff is something really important, return 1 -> error
 compare_output () {
 	# 1=diff_file
@@ -87,6 +106,7 @@ compare_output () {
 	< max_size: [0-9]*
 	---
 	> max_size: [0-9]*$
+	^[<>]   what\(\):  .*$
 	EOF
 	)
 
@@ -94,6 +114,27 @@ compare_output () {
 	[ "$?" -eq "0" ] && return 1 || return 2;
 }
 
+# Reads the measure.out stats of both binaries ("wall user sys rss"),
+# prints "cpu ft/std ms, rss ft/std KB" and returns 1 when ft exceeds
+# perf_factor times std on either, after applying the floors; nothing is
+# compared when one of them did not compile
+compare_perf () {
+	# 1=ft_stats 2=std_stats
+	if ! [ -s $1 ] || ! [ -s $2 ]; then
+		printf "not run"
+		return 0
+	fi
+	awk -v factor="$perf_factor" -v min_ms="$perf_min_ms" -v min_kb="$perf_min_kb" '
+		NR == 1 { ft_cpu = $2 + $3; ft_rss = $4 }
+		NR == 2 { std_cpu = $2 + $3; std_rss = $4 }
+		END {
+			printf "cpu %.0f/%.0f ms, rss %d/%d KB", ft_cpu, std_cpu, ft_rss, std_rss
+			slow = ft_cpu > factor * (std_cpu > min_ms ? std_cpu : min_ms)
+			fat = ft_rss > factor * (std_rss > min_kb ? std_rss : min_kb)
+			exit (slow || fat)
+		}' $1 $2
+}
+
 isEq () {
 	[ $1 -eq $2 ] && echo 0 || echo 1
 }
@@ -109,10 +150,14 @@ cmp_one () {
 	ft_bin="ft.$container.out"; ft_log="$logdir/ft.$testname.$container.log"
 	std_bin="std.$container.out"; std_log="$logdir/std.$testname.$container.log"
 	diff_file="$deepdir/$testname.$container.diff"
+	perf_file="$deepdir/$testname.$container.perf"
+	ft_stats="$logdir/ft.$testname.$container.stats"
+	std_stats="$logdir/std.$testname.$container.stats"
 
 	clean_trailing_files () {
-		rm -f $ft_bin $std_bin
-		[ -s "$diff_file" ] || rm -f $diff_file $ft_log $std_log &>/dev/null
+		rm -f $ft_bin $std_bin $ft_stats $std_stats
+		[ -s "$diff_file" ] || rm -f $diff_file &>/dev/null
+		[ -s "$diff_file" ] || [ -s "$perf_file" ] || rm -f $ft_log $std_log &>/dev/null
 		rmdir $deepdir $logdir &>/dev/null
 	}
 
@@ -125,23 +170,33 @@ cmp_one () {
 	same_compilation=$(isEq $ft_ret $std_ret)
 	std_compile=$std_ret
 
-	> $ft_log; > $std_log;
-	# Starting async binaries execution (if compilation succeeded)
-	if [ ${ft_ret} -eq 0 ]; then
-		./${ft_bin} &>${ft_log} &
-		ft_pid=$!;
-	fi
-	if [ ${std_ret} -eq 0 ]; then
-		./${std_bin} &>${std_log} &
-		std_pid=$!;
-	fi
-
-	# Waiting binaries execution (if compilation succeeded)
-	if [ "${ft_ret}" -eq 0 ]; then
-		wait ${ft_pid}; ft_ret=$?;
-	fi
-	if [ "${std_ret}" -eq 0 ]; then
-		wait ${std_pid}; std_ret=$?;
+	> $ft_log; > $std_log; rm -f $ft_stats $std_stats $perf_file;
+	if [ $perf_mode -eq 1 ]; then
+		# Measured binaries run one at a time
+		if [ ${ft_ret} -eq 0 ]; then
+			${measure_bin} ${ft_stats} ./${ft_bin} &>${ft_log}; ft_ret=$?;
+		fi
+		if [ ${std_ret} -eq 0 ]; then
+			${measure_bin} ${std_stats} ./${std_bin} &>${std_log}; std_ret=$?;
+		fi
+	else
+		# Starting async binaries execution (if compilation succeeded)
+		if [ ${ft_ret} -eq 0 ]; then
+			./${ft_bin} &>${ft_log} &
+			ft_pid=$!;
+		fi
+		if [ ${std_ret} -eq 0 ]; then
+			./${std_bin} &>${std_log} &
+			std_pid=$!;
+		fi
+
+		# Waiting binaries execution (if compilation succeeded)
+		if [ "${ft_ret}" -eq 0 ]; then
+			wait ${ft_pid}; ft_ret=$?;
+		fi
+		if [ "${std_ret}" -eq 0 ]; then
+			wait ${std_pid}; std_ret=$?;
+		fi
 	fi
 	same_bin=$(isEq $ft_ret $std_ret)
 
@@ -149,7 +204,17 @@ cmp_one () {
 	compare_output $diff_file
 	same_output=$?
 
-	printRes "$container/$file" $same_compilation $same_bin $same_output $std_compile
+	perf=""; perf_summary="";
+	if [ $perf_mode -eq 1 ]; then
+		perf_summary=$(compare_perf $ft_stats $std_stats)
+		perf=$?
+		[ $perf -eq 0 ] || echo "$perf_summary" > $perf_file
+	fi
+
+	printRes "$container/$file" $same_compilation $same_bin $same_output $std_compile $perf "$perf_summary"
+	if [ $same_compilation -eq 1 ] || [ $same_bin -eq 1 ] || [ $same_output -eq 1 ] || [ "$perf" = "1" ]; then
+		failures=$((failures + 1))
+	fi
 	clean_trailing_files
 }
 
@@ -162,16 +227,28 @@ do_test () {
 	done
 }
 
+enable_perf () {
+	perf_mode=1
+	$CC -o ${measure_bin} measure.cpp
+}
+
 function main () {
 	pheader
-	containers=(vector map stack set)
+	if [ "$1" = "--perf" ]; then
+		shift
+		enable_perf || return 1
+	fi
+	containers=(vector map stack deque set multimap multiset flat_map flat_set btree_map btree_set unordered_map unordered_set)
 	# containers=(vector list map stack queue deque multimap set multiset)
 	if [ $# -ne 0 ]; then
 		containers=($@);
 	fi
 
+	failures=0
 	for container in ${containers[@]}; do
 		printf "%40s\n" $container
 		do_test $container 2>/dev/null
 	done
+	[ $perf_mode -eq 1 ] && rm -f ${measure_bin}
+	[ $failures -eq 0 ]
 }
@@ -0,0 +1,52 @@
+// Runs a test binary and writes its resource usage to a file, for the
+// timing mode of fct.sh (no GNU time needed):
+//   ./measure.out <stats_file> <binary> [args...]
+// stats_file gets "wall_ms user_ms sys_ms peak_rss_kb", the exit status is
+// the binary's (128 + signal if it was killed)
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdio>
+
+static double	ms(const struct timeval& tv) {
+	return tv.tv_sec * 1e3 + tv.tv_usec / 1e3;
+}
+
+int	main(int argc, char** argv) {
+	if (argc < 3) {
+		std::fprintf(stderr, "usage: %s stats_file binary [args...]\n", argv[0]);
+		return 2;
+	}
+	struct timeval	start;
+	struct timeval	end;
+	struct rusage	ru;
+	int				status = 0;
+
+	gettimeofday(&start, NULL);
+	pid_t	pid = fork();
+	if (pid < 0)
+		return 2;
+	if (pid == 0) {
+		execv(argv[2], argv + 2);
+		_exit(127);
+	}
+	if (wait4(pid, &status, 0, &ru) < 0)
+		return 2;
+	gettimeofday(&end, NULL);
+
+	long	rss_kb = ru.ru_maxrss;
+#ifdef __APPLE__
+	rss_kb /= 1024; // bytes on macOS, kilobytes on Linux
+#endif
+	std::FILE*	out = std::fopen(argv[1], "w");
+	if (out == NULL)
+		return 2;
+	std::fprintf(out, "%.1f %.1f %.1f %ld\n", ms(end) - ms(start),
+		ms(ru.ru_utime), ms(ru.ru_stime), rss_kb);
+	std::fclose(out);
+	if (WIFSIGNALED(status))
+		return 128 + WTERMSIG(status);
+	return WEXITSTATUS(status);
+}
@@ -0,0 +1,70 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+typedef _btree_map<T1, T2>::value_type T3;
+typedef _btree_map<T1, T2>::iterator ft_iterator;
+typedef _btree_map<T1, T2>::const_iterator ft_const_iterator;
+
+static int iter = 0;
+
+template <typename MAP>
+void	ft_bound(MAP &mp, const T1 &param)
+{
+	ft_iterator ite = mp.end(), it[2];
+	_pair<ft_iterator, ft_iterator> ft_range;
+
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	std::cout << "with key [" << param << "]:" << std::endl;
+	it[0] = mp.lower_bound(param); it[1] = mp.upper_bound(param);
+	ft_range = mp.equal_range(param);
+	std::cout << "lower_bound: " << (it[0] == ite ? "end()" : printPair(it[0], false)) << std::endl;
+	std::cout << "upper_bound: " << (it[1] == ite ? "end()" : printPair(it[1], false)) << std::endl;
+	std::cout << "equal_range: " << (ft_range.first == it[0] && ft_range.second == it[1]) << std::endl;
+}
+
+template <typename MAP>
+void	ft_const_bound(const MAP &mp, const T1 &param)
+{
+	ft_const_iterator ite = mp.end(), it[2];
+	_pair<ft_const_iterator, ft_const_iterator> ft_range;
+
+	std::cout << "\t-- [" << iter++ << "] (const) --" << std::endl;
+	std::cout << "with key [" << param << "]:" << std::endl;
+	it[0] = mp.lower_bound(param); it[1] = mp.upper_bound(param);
+	ft_range = mp.equal_range(param);
+	std::cout << "lower_bound: " << (it[0] == ite ? "end()" : printPair(it[0], false)) << std::endl;
+	std::cout << "upper_bound: " << (it[1] == ite ? "end()" : printPair(it[1], false)) << std::endl;
+	std::cout << "equal_range: " << (ft_range.first == it[0] && ft_range.second == it[1]) << std::endl;
+}
+
+int		main(void)
+{
+	_btree_map<T1, T2>	mp;
+
+	ft_bound(mp, 0);
+	ft_const_bound(mp, 0);
+
+	// multiples of 3 over a few levels: hits, misses on both sides of each
+	// value, and keys before and after all of them
+	for (int i = 0; i < 3000; ++i)
+		mp.insert(T3(i * 3, i));
+	printWalk(mp);
+
+	for (int k = -5; k < 9005; k += 97)
+		ft_const_bound(mp, k);
+	for (int k = 0; k < 9000; k += 301) {
+		ft_bound(mp, k);
+		ft_bound(mp, k + 1);
+		ft_const_bound(mp, k + 2);
+	}
+	ft_bound(mp, 8997);
+	ft_bound(mp, 8998);
+	ft_const_bound(mp, -1);
+
+	mp.lower_bound(3)->second = 404;
+	mp.upper_bound(7)->second = 842;
+	ft_bound(mp, 3);
+	ft_bound(mp, 8);
+	return (0);
+}
@@ -0,0 +1,53 @@
+#include "../base.hpp"
+#if !defined(USING_STD)
+# include "btree_map.hpp"
+# define _btree_map ft::btree_map
+#else
+# include <map>
+# define _btree_map std::map
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+// max_size is left out: it depends on the node layout, not on std::map's
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	if (print_content)
+	{
+		typename T_MAP::const_iterator it = mp.begin(), ite = mp.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// Walks mp both ways and prints what a full dump would only show in bulk:
+// the number of elements met each way and the sum of their keys
+template <typename T_MAP>
+void	printWalk(T_MAP const &mp)
+{
+	typename T_MAP::const_iterator it = mp.begin(), ite = mp.end();
+	long	sum = 0;
+	size_t	fwd = 0, bwd = 0;
+
+	for (; it != ite; ++it, ++fwd)
+		sum += it->first;
+	while (it != mp.begin()) {
+		--it;
+		++bwd;
+	}
+	std::cout << "size: " << mp.size() << " | forward: " << fwd << " | backward: " << bwd
+		<< " | key sum: " << sum << std::endl;
+}
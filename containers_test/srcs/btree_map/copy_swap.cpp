@@ -0,0 +1,63 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+typedef _btree_map<T1, T2>::value_type T3;
+
+static void	cmp(const _btree_map<T1, T2> &lhs, const _btree_map<T1, T2> &rhs)
+{
+	static int i = 0;
+
+	std::cout << "############### [" << i++ << "] ###############"  << std::endl;
+	std::cout << "eq: " << (lhs == rhs) << " | ne: " << (lhs != rhs) << std::endl;
+	std::cout << "lt: " << (lhs <  rhs) << " | le: " << (lhs <= rhs) << std::endl;
+	std::cout << "gt: " << (lhs >  rhs) << " | ge: " << (lhs >= rhs) << std::endl;
+}
+
+int		main(void)
+{
+	_btree_map<T1, T2>	mp;
+
+	for (int i = 0; i < 1500; ++i)
+		mp.insert(T3((i * 7919) % 1500, std::string(i % 7 + 1, 'a' + i % 26)));
+
+	// copies are structural: same content, independent storage
+	_btree_map<T1, T2>	copy(mp), assigned, small;
+
+	assigned = copy;
+	printWalk(copy);
+	printWalk(assigned);
+	cmp(mp, copy);
+	copy.erase(700);
+	assigned[700] = "changed";
+	cmp(mp, copy);
+	cmp(mp, assigned);
+	std::cout << "mp[700]: " << mp[700] << " | assigned[700]: " << assigned[700] << std::endl;
+
+	small[1] = "one";
+	small[2] = "two";
+	assigned = small;
+	printSize(assigned);
+	cmp(assigned, small);
+
+	// swap exchanges the trees, iterators follow the elements
+	_btree_map<T1, T2>::iterator it = mp.find(3), sit = small.begin();
+
+	mp.swap(small);
+	printSize(mp);
+	printWalk(small);
+	std::cout << "iterators: " << printPair(it, false) << " | " << printPair(sit, false) << std::endl;
+	swap(mp, small);
+	printWalk(mp);
+	cmp(mp, small);
+
+	mp.clear();
+	std::cout << "empty: " << mp.empty() << std::endl;
+	printSize(mp);
+	mp = small;
+	small.clear();
+	printWalk(mp);
+	printWalk(small);
+	cmp(mp, small);
+	return (0);
+}
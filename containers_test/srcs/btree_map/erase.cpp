@@ -0,0 +1,86 @@
+#include "common.hpp"
+#include <list>
+
+#define T1 int
+#define T2 std::string
+typedef _btree_map<T1, T2>::value_type T3;
+
+static int iter = 0;
+
+template <typename MAP, typename U>
+void	ft_erase(MAP &mp, U param)
+{
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	mp.erase(param);
+	printSize(mp);
+}
+
+template <typename MAP, typename U, typename V>
+void	ft_erase(MAP &mp, U param, V param2)
+{
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	mp.erase(param, param2);
+	printSize(mp);
+}
+
+int		main(void)
+{
+	std::list<T3> lst;
+	unsigned int lst_size = 10;
+	for (unsigned int i = 0; i < lst_size; ++i)
+		lst.push_back(T3(i, std::string((lst_size - i), i + 65)));
+	_btree_map<T1, T2> mp(lst.begin(), lst.end());
+	printSize(mp);
+
+	ft_erase(mp, ++mp.begin());
+	ft_erase(mp, mp.begin());
+	ft_erase(mp, --mp.end());
+	ft_erase(mp, mp.begin(), ++(++(++mp.begin())));
+	ft_erase(mp, --(--(--mp.end())), --mp.end());
+	ft_erase(mp, 42);
+	ft_erase(mp, 5);
+
+	mp[10] = "Hello";
+	mp[11] = "Hi there";
+	printSize(mp);
+	ft_erase(mp, --(--(--mp.end())), mp.end());
+	ft_erase(mp, mp.begin(), mp.end());
+
+	// on a tree of a few levels: values are taken from siblings, nodes are
+	// merged and the root goes away as it empties
+	const int	n = 5000;
+	_btree_map<T1, T2>	big;
+
+	for (int i = 0; i < n; ++i)
+		big.insert(T3(i, "big"));
+	for (int i = 0; i < n; i += 2)
+		std::cout << big.erase(i);
+	std::cout << std::endl;
+	printWalk(big);
+	std::cout << "erase missing: " << big.erase(0) << big.erase(n) << std::endl;
+
+	// a range in the middle, then everything else in a scattered order
+	_btree_map<T1, T2>::iterator first = big.lower_bound(1001), last = big.lower_bound(3001);
+	big.erase(first, last);
+	printWalk(big);
+	std::cout << "around the range: " << printPair(--big.lower_bound(1001), false)
+		<< " | " << printPair(big.lower_bound(1001), false) << std::endl;
+	for (int i = 0; i < n; ++i) {
+		big.erase((i * 7919) % n);
+		if (i % 250 == 0)
+			printWalk(big);
+	}
+	printSize(big);
+
+	// erasing through iterators, from both ends
+	for (int i = 0; i < n; ++i)
+		big.insert(T3(i, "again"));
+	while (big.size() > 10) {
+		big.erase(big.begin());
+		big.erase(--big.end());
+		if (big.size() % 500 == 0)
+			printWalk(big);
+	}
+	printSize(big);
+	return (0);
+}
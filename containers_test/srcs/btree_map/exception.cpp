@@ -0,0 +1,73 @@
+#include "common.hpp"
+#include <stdexcept>
+
+// Copying throws once armed; moving never does, so the B-tree relocates
+// values in place and builds the inserted one aside before splitting
+static int	armed = 0;
+
+class thrower {
+	public:
+		thrower(int v = 0) : value(v) { };
+		thrower(thrower const &src) : value(src.value) {
+			if (armed) {
+				armed = 0;
+				throw std::runtime_error("thrower copy");
+			}
+		};
+#if __cplusplus >= 201103L
+		thrower(thrower &&src) noexcept : value(src.value) { };
+		thrower &operator=(thrower &&src) noexcept { value = src.value; return *this; };
+#endif
+		thrower &operator=(thrower const &src) { value = src.value; return *this; };
+		int		value;
+};
+
+std::ostream	&operator<<(std::ostream &o, thrower const &t) {
+	o << t.value;
+	return o;
+}
+
+#define T1 int
+#define T2 thrower
+typedef _btree_map<T1, T2>::value_type T3;
+
+int		main(void)
+{
+	const int		n = 1000;
+	_btree_map<T1, T2>	base;
+	int				caught = 0;
+
+	// sorted insertion leaves every leaf but the last one a value short
+	// of full
+	for (int i = 0; i < n; ++i)
+		base.insert(T3(i * 4, thrower(i)));
+	printWalk(base);
+
+	// into a copy of the tree, 4k + 2 fills the leaf holding 4k when it is
+	// that leaf's last value, 4k + 3 then goes past it: the copy throws,
+	// then the insert succeeds
+	for (int k = -1; k < n; ++k)
+	{
+		_btree_map<T1, T2>	mp(base);
+		T3					val(k * 4 + 3, thrower(k));
+
+		mp.insert(T3(k * 4 + 2, thrower(k)));
+		armed = 1;
+		try {
+			mp.insert(val);
+		}
+		catch (std::runtime_error &e) {
+			++caught;
+		}
+		armed = 0;
+		printWalk(mp);
+		mp.insert(val);
+		printWalk(mp);
+	}
+	std::cout << "caught: " << caught << std::endl;
+
+	_btree_map<T1, T2>	mp(base.begin(), inc(base.begin(), 10));
+
+	printSize(mp);
+	return (0);
+}
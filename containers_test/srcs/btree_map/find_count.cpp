@@ -0,0 +1,67 @@
+#include "common.hpp"
+#include <stdexcept>
+
+#define T1 int
+#define T2 int
+typedef _btree_map<T1, T2>::value_type T3;
+
+static int iter = 0;
+
+template <typename MAP>
+void	ft_find(MAP &mp, T1 const &k)
+{
+	typename MAP::iterator ret = mp.find(k);
+
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	if (ret != mp.end())
+		printPair(ret);
+	else
+		std::cout << "map::find(" << k << ") returned end()" << std::endl;
+	std::cout << "count: " << mp.count(k) << std::endl;
+}
+
+template <typename MAP>
+void	ft_at(MAP const &mp, T1 const &k)
+{
+	try {
+		std::cout << "at(" << k << "): " << mp.at(k) << std::endl;
+	}
+	catch (std::out_of_range &e) {
+		std::cout << "at(" << k << "): out_of_range" << std::endl;
+	}
+}
+
+int		main(void)
+{
+	_btree_map<T1, T2>	mp;
+
+	ft_find(mp, 0);
+	ft_at(mp, 0);
+	for (int i = 0; i < 3000; ++i)
+		mp[(i * 7919) % 3000 * 2] = i;
+	printWalk(mp);
+
+	for (int k = -1; k < 6002; k += 173) {
+		ft_find(mp, k);
+		ft_find(mp, k + 1);
+		ft_at(mp, k);
+	}
+
+	// operator[] inserts a value-initialized element only when k is missing
+	mp[1] += 5;
+	mp[2] += 5;
+	ft_find(mp, 1);
+	ft_find(mp, 2);
+	mp.at(4) = 404;
+	ft_at(mp, 4);
+	mp.find(6)->second = 606;
+	ft_at(mp, 6);
+	printWalk(mp);
+
+	const _btree_map<T1, T2>	cmp(mp);
+
+	ft_at(cmp, 6);
+	ft_at(cmp, 7);
+	std::cout << "const find: " << printPair(cmp.find(8), false) << " | count: " << cmp.count(9) << std::endl;
+	return (0);
+}
@@ -0,0 +1,69 @@
+#include "common.hpp"
+#include <list>
+
+#define T1 int
+#define T2 std::string
+typedef _btree_map<T1, T2>::value_type T3;
+typedef _btree_map<T1, T2>::iterator iterator;
+
+static int iter = 0;
+
+template <typename MAP>
+void	ft_insert(MAP &mp, T3 const &val)
+{
+	_pair<iterator, bool> ret = mp.insert(val);
+
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	std::cout << "insert return: " << printPair(ret.first, false);
+	std::cout << " | Created: " << ret.second << std::endl;
+	printSize(mp);
+}
+
+int		main(void)
+{
+	_btree_map<T1, T2>	mp, mp2;
+
+	ft_insert(mp, T3(42, "lol"));
+	ft_insert(mp, T3(42, "mdr"));
+	ft_insert(mp, T3(50, "mdr"));
+	ft_insert(mp, T3(35, "funny"));
+	ft_insert(mp, T3(45, "bunny"));
+	ft_insert(mp, T3(21, "fizz"));
+	ft_insert(mp, T3(38, "buzz"));
+	ft_insert(mp, T3(55, "fuzzy"));
+
+	// the hint is only used at end(), for sorted input
+	std::cout << "hint: " << printPair(mp.insert(mp.end(), T3(60, "end")), false) << std::endl;
+	std::cout << "hint: " << printPair(mp.insert(mp.end(), T3(1, "front")), false) << std::endl;
+	std::cout << "hint: " << printPair(mp.insert(mp.begin(), T3(40, "middle")), false) << std::endl;
+	std::cout << "hint: " << printPair(mp.insert(mp.end(), T3(42, "dup")), false) << std::endl;
+	printSize(mp);
+
+	// range, unsorted and with duplicates: the first one stays
+	std::list<T3> lst;
+	for (int i = 0; i < 20; ++i)
+		lst.push_back(T3((i * 7) % 13, std::string(i % 5 + 1, 'a' + i)));
+	mp2.insert(lst.begin(), lst.end());
+	printSize(mp2);
+
+	// enough values for a few levels, in sorted, reverse and scattered order
+	const int	n = 5000;
+	_btree_map<T1, T2>	up, down, scattered;
+
+	for (int i = 0; i < n; ++i) {
+		up.insert(up.end(), T3(i, "up"));
+		down.insert(T3(n - 1 - i, "down"));
+		scattered.insert(T3((i * 7919) % n, "scattered"));
+	}
+	printWalk(up);
+	printWalk(down);
+	printWalk(scattered);
+	for (int i = 0; i < n; i += 499)
+		std::cout << "- " << printPair(scattered.find(i), false) << std::endl;
+
+	_btree_map<T1, T2>	range(scattered.begin(), scattered.end());
+	printWalk(range);
+	std::cout << "equal: " << (range == up) << " | first: " << printPair(range.begin(), false)
+		<< " | last: " << printPair(--range.end(), false) << std::endl;
+	return (0);
+}
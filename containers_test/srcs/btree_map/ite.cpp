@@ -0,0 +1,54 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 foo<int>
+typedef _btree_map<T1, T2>::value_type T3;
+typedef _btree_map<T1, T2>::iterator iterator;
+typedef _btree_map<T1, T2>::const_iterator const_iterator;
+typedef _btree_map<T1, T2>::reverse_iterator reverse_iterator;
+typedef _btree_map<T1, T2>::const_reverse_iterator const_reverse_iterator;
+
+int		main(void)
+{
+	_btree_map<T1, T2>	mp;
+
+	std::cout << "empty: " << (mp.begin() == mp.end()) << (mp.rbegin() == mp.rend()) << std::endl;
+	for (int i = 0; i < 2000; ++i)
+		mp.insert(T3((i * 7919) % 2000, T2(i)));
+
+	// iterators cross leaves and internal nodes both ways
+	iterator		it = mp.begin(), ite = mp.end();
+	const_iterator	cit = mp.begin();
+	int				i = 0;
+
+	for (; it != ite; ++it, ++i)
+		if (i % 97 == 0)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	for (i = 0; it != mp.begin(); ++i) {
+		it--;
+		if (i % 101 == 0)
+			std::cout << "<- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "const: " << (cit == it) << " | " << printPair(cit, false) << std::endl;
+
+	// post increment/decrement, and arrow through both iterators
+	it = mp.find(500);
+	std::cout << printPair(it++, false) << " | " << printPair(it--, false) << " | " << printPair(it, false) << std::endl;
+	it->second.m();
+	(++it)->second.m();
+	it->second = 42;
+	cit = it;
+	cit->second.m();
+	std::cout << "value: " << (*cit).second << std::endl;
+
+	// reverse iterators
+	reverse_iterator		rit = mp.rbegin(), rite = mp.rend();
+	const_reverse_iterator	crit = mp.rbegin();
+
+	for (i = 0; rit != rite; ++rit, ++i)
+		if (i % 211 == 0)
+			std::cout << "r " << rit->first << " " << (*rit).second << std::endl;
+	std::cout << "rbegin: " << crit->first << " | rend - 1: " << (--rit)->first << std::endl;
+	std::cout << "base: " << printPair(--mp.rbegin().base(), false) << std::endl;
+	return (0);
+}
@@ -0,0 +1,44 @@
+#include "common.hpp"
+
+#define T1 int
+typedef _btree_set<T1>::const_iterator ft_const_iterator;
+
+static int iter = 0;
+
+template <typename SET>
+void	ft_bound(const SET &st, const T1 &param)
+{
+	ft_const_iterator ite = st.end(), it[2];
+	_pair<ft_const_iterator, ft_const_iterator> ft_range;
+
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	std::cout << "with key [" << param << "]:" << std::endl;
+	it[0] = st.lower_bound(param); it[1] = st.upper_bound(param);
+	ft_range = st.equal_range(param);
+	std::cout << "lower_bound: " << (it[0] == ite ? "end()" : printPair(it[0], false)) << std::endl;
+	std::cout << "upper_bound: " << (it[1] == ite ? "end()" : printPair(it[1], false)) << std::endl;
+	std::cout << "equal_range: " << (ft_range.first == it[0] && ft_range.second == it[1]) << std::endl;
+	std::cout << "find: " << (st.find(param) == ite ? "end()" : printPair(st.find(param), false))
+		<< " | count: " << st.count(param) << std::endl;
+}
+
+int		main(void)
+{
+	_btree_set<T1>	st;
+
+	ft_bound(st, 1);
+	for (int i = 0; i < 10000; ++i)
+		st.insert((i * 7919) % 10000 * 5);
+	printWalk(st);
+	for (int k = -3; k < 50005; k += 353) {
+		ft_bound(st, k);
+		ft_bound(st, k - k % 5);
+	}
+
+	// reverse iteration across nodes
+	_btree_set<T1>::reverse_iterator rit = st.rbegin(), rite = st.rend();
+	for (int i = 0; rit != rite; ++rit, ++i)
+		if (i % 777 == 0)
+			std::cout << "r " << *rit << std::endl;
+	return (0);
+}
@@ -0,0 +1,52 @@
+#include "../base.hpp"
+#if !defined(USING_STD)
+# include "btree_set.hpp"
+# define _btree_set ft::btree_set
+#else
+# include <set>
+# define _btree_set std::set
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "value: " << *iterator;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+// max_size is left out: it depends on the node layout, not on std::set's
+template <typename T_SET>
+void	printSize(T_SET const &st, bool print_content = 1)
+{
+	std::cout << "size: " << st.size() << std::endl;
+	if (print_content)
+	{
+		typename T_SET::const_iterator it = st.begin(), ite = st.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// Walks st both ways: the number of elements met each way and their sum
+template <typename T_SET>
+void	printWalk(T_SET const &st)
+{
+	typename T_SET::const_iterator it = st.begin(), ite = st.end();
+	long	sum = 0;
+	size_t	fwd = 0, bwd = 0;
+
+	for (; it != ite; ++it, ++fwd)
+		sum += *it;
+	while (it != st.begin()) {
+		--it;
+		++bwd;
+	}
+	std::cout << "size: " << st.size() << " | forward: " << fwd << " | backward: " << bwd
+		<< " | sum: " << sum << std::endl;
+}
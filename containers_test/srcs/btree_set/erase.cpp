@@ -0,0 +1,47 @@
+#include "common.hpp"
+
+#define T1 int
+
+int		main(void)
+{
+	const int		n = 20000;
+	_btree_set<T1>	st;
+
+	for (int i = 0; i < n; ++i)
+		st.insert(i);
+
+	// every third value, then a middle range, then the rest scattered
+	for (int i = 0; i < n; i += 3)
+		std::cout << st.erase(i);
+	std::cout << std::endl;
+	printWalk(st);
+	st.erase(st.lower_bound(5000), st.upper_bound(15000));
+	printWalk(st);
+	std::cout << "around the range: " << *--st.lower_bound(5000) << " | " << *st.lower_bound(5000) << std::endl;
+	for (int i = 0; i < n; ++i) {
+		st.erase((i * 7919) % n);
+		if (i % 1000 == 0)
+			printWalk(st);
+	}
+	printSize(st);
+
+	// through iterators, alternating between both ends and the middle
+	for (int i = 0; i < 3000; ++i)
+		st.insert(i * 2);
+	while (st.size() > 5) {
+		_btree_set<T1>::iterator it = st.lower_bound(st.size());
+		T1	mid = (it == st.end()) ? -1 : *it;
+
+		// erasing invalidates every iterator: the middle is found again
+		st.erase(st.begin());
+		st.erase(--st.end());
+		if (st.count(mid))
+			st.erase(st.find(mid));
+		if (st.size() % 100 < 3)
+			printWalk(st);
+	}
+	printSize(st);
+	st.erase(st.begin(), st.end());
+	printSize(st);
+	return (0);
+}
@@ -0,0 +1,51 @@
+#include "common.hpp"
+#include <list>
+
+#define T1 int
+typedef _btree_set<T1>::iterator iterator;
+
+static int iter = 0;
+
+template <typename SET>
+void	ft_insert(SET &st, T1 const &val)
+{
+	_pair<iterator, bool> ret = st.insert(val);
+
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	std::cout << "insert return: " << printPair(ret.first, false);
+	std::cout << " | Created: " << ret.second << std::endl;
+	printSize(st);
+}
+
+int		main(void)
+{
+	_btree_set<T1>	st;
+
+	ft_insert(st, 42);
+	ft_insert(st, 42);
+	ft_insert(st, 21);
+	ft_insert(st, 84);
+	ft_insert(st, 0);
+	std::cout << "hint: " << printPair(st.insert(st.end(), 100), false) << std::endl;
+	std::cout << "hint: " << printPair(st.insert(st.end(), 50), false) << std::endl;
+	std::cout << "hint: " << printPair(st.insert(st.begin(), 21), false) << std::endl;
+	printSize(st);
+
+	std::list<T1> lst;
+	for (int i = 0; i < 30; ++i)
+		lst.push_back((i * 11) % 17);
+	_btree_set<T1>	st2(lst.begin(), lst.end());
+	printSize(st2);
+
+	const int	n = 20000;
+	_btree_set<T1>	up, scattered;
+
+	for (int i = 0; i < n; ++i) {
+		up.insert(up.end(), i);
+		scattered.insert((i * 7919) % n);
+	}
+	printWalk(up);
+	printWalk(scattered);
+	std::cout << "equal: " << (up == scattered) << std::endl;
+	return (0);
+}
@@ -0,0 +1,88 @@
+#include "../base.hpp"
+#include <iterator>
+#if !defined(USING_STD)
+# include "flat_map.hpp"
+# define _flat_map ft::flat_map
+#else
+# include <map>
+# define _flat_map std::map
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+// max_size is left out: flat_map's is the one of its key vector
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	if (print_content)
+	{
+		typename T_MAP::const_iterator it = mp.begin(), ite = mp.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// flat_map iterators are random access, std::map's bidirectional: ft
+// uses the operators, std walks
+template <typename It>
+It		ahead(It it, int n)
+{
+#if !defined(USING_STD)
+	return (it + n);
+#else
+	return (inc(it, n));
+#endif /* !defined(STD) */
+}
+
+template <typename It>
+It		behind(It it, int n)
+{
+#if !defined(USING_STD)
+	return (it - n);
+#else
+	return (dec(it, n));
+#endif /* !defined(STD) */
+}
+
+template <typename It>
+long	between(It first, It last)
+{
+#if !defined(USING_STD)
+	return (last - first);
+#else
+	return (std::distance(first, last));
+#endif /* !defined(STD) */
+}
+
+// A range sorted without equivalent keys, tagged sorted_unique for ft
+template <typename T_MAP, typename It>
+T_MAP	fromSorted(It first, It last)
+{
+#if !defined(USING_STD)
+	return (T_MAP(ft::sorted_unique, first, last));
+#else
+	return (T_MAP(first, last));
+#endif /* !defined(STD) */
+}
+
+template <typename T_MAP, typename It>
+void	insertSorted(T_MAP &mp, It first, It last)
+{
+#if !defined(USING_STD)
+	mp.insert(ft::sorted_unique, first, last);
+#else
+	mp.insert(first, last);
+#endif /* !defined(STD) */
+}
@@ -0,0 +1,62 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+typedef _flat_map<T1, T2>::value_type T3;
+
+static int iter = 0;
+
+template <typename MAP, typename U>
+void	ft_erase(MAP &mp, U param)
+{
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	mp.erase(param);
+	printSize(mp);
+}
+
+template <typename MAP, typename U, typename V>
+void	ft_erase(MAP &mp, U param, V param2)
+{
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	mp.erase(param, param2);
+	printSize(mp);
+}
+
+int		main(void)
+{
+	_flat_map<T1, T2>	mp;
+
+	for (int i = 0; i < 20; ++i)
+		mp[i] = std::string(20 - i, 'A' + i);
+	printSize(mp);
+
+	// ranges: in the middle, at both ends, empty, then everything
+	ft_erase(mp, ahead(mp.begin(), 5), ahead(mp.begin(), 9));
+	ft_erase(mp, mp.begin(), ahead(mp.begin(), 2));
+	ft_erase(mp, behind(mp.end(), 3), mp.end());
+	ft_erase(mp, ahead(mp.begin(), 4), ahead(mp.begin(), 4));
+	ft_erase(mp, mp.lower_bound(12), mp.upper_bound(14));
+
+	// single elements
+	ft_erase(mp, mp.begin());
+	ft_erase(mp, --mp.end());
+	ft_erase(mp, mp.find(10));
+	std::cout << "by key: " << mp.erase(9) << mp.erase(9) << mp.erase(42) << std::endl;
+	printSize(mp);
+	ft_erase(mp, mp.begin(), mp.end());
+
+	// a large map, emptied through ranges of every size
+	for (int i = 0; i < 5000; ++i)
+		mp[i] = "x";
+	for (int n = 1; !mp.empty(); ++n) {
+		int	at = static_cast<int>(mp.size()) / 3;
+		int	len = n < static_cast<int>(mp.size()) - at ? n : static_cast<int>(mp.size()) - at;
+
+		mp.erase(ahead(mp.begin(), at), ahead(mp.begin(), at + len));
+		if (n % 10 == 0)
+			std::cout << "size: " << mp.size() << " | first: " << (mp.empty() ? -1 : mp.begin()->first)
+				<< " | last: " << (mp.empty() ? -1 : (--mp.end())->first) << std::endl;
+	}
+	printSize(mp);
+	return (0);
+}
@@ -0,0 +1,71 @@
+#include "common.hpp"
+#include <list>
+#include <vector>
+
+#define T1 int
+#define T2 std::string
+typedef _flat_map<T1, T2>::value_type T3;
+
+int		main(void)
+{
+	// equivalent keys in one range: the first one wins, as with one
+	// insert per element
+	std::list<T3> lst;
+	lst.push_back(T3(5, "five"));
+	lst.push_back(T3(1, "one"));
+	lst.push_back(T3(5, "five again"));
+	lst.push_back(T3(3, "three"));
+	lst.push_back(T3(1, "one again"));
+	lst.push_back(T3(9, "nine"));
+	lst.push_back(T3(3, "three again"));
+
+	_flat_map<T1, T2>	mp(lst.begin(), lst.end());
+	printSize(mp);
+
+	// keys already present stay as they are
+	std::list<T3> more;
+	more.push_back(T3(4, "four"));
+	more.push_back(T3(5, "not five"));
+	more.push_back(T3(0, "zero"));
+	more.push_back(T3(10, "ten"));
+	more.push_back(T3(4, "not four"));
+	more.push_back(T3(9, "not nine"));
+	mp.insert(more.begin(), more.end());
+	printSize(mp);
+
+	// empty and single element ranges
+	mp.insert(more.begin(), more.begin());
+	mp.insert(lst.begin(), ++lst.begin());
+	more.clear();
+	more.push_back(T3(7, "seven"));
+	mp.insert(more.begin(), more.end());
+	printSize(mp);
+
+	// a large range in scattered order with every key twice
+	std::vector<T3> big;
+	for (int i = 0; i < 6000; ++i)
+		big.push_back(T3((i * 7919) % 3000, std::string(1, 'a' + i / 3000)));
+	_flat_map<T1, T2>	large;
+	large.insert(big.begin(), big.end());
+	std::cout << "size: " << large.size() << " | first: " << printPair(large.begin(), false)
+		<< " | last: " << printPair(--large.end(), false) << std::endl;
+	int		from_second_half = 0;
+	for (_flat_map<T1, T2>::iterator it = large.begin(); it != large.end(); ++it)
+		from_second_half += (it->second == "b");
+	std::cout << "values from the second copy: " << from_second_half << std::endl;
+
+	// merged into existing content
+	large.insert(mp.begin(), mp.end());
+	printSize(_flat_map<T1, T2>(large.begin(), ahead(large.begin(), 12)));
+
+	// single inserts and hints
+	_pair<_flat_map<T1, T2>::iterator, bool> ret = mp.insert(T3(2, "two"));
+	std::cout << "insert: " << printPair(ret.first, false) << " | " << ret.second << std::endl;
+	ret = mp.insert(T3(2, "deux"));
+	std::cout << "insert: " << printPair(ret.first, false) << " | " << ret.second << std::endl;
+	std::cout << "hint: " << printPair(mp.insert(mp.find(3), T3(-1, "wrong hint")), false) << std::endl;
+	std::cout << "hint: " << printPair(mp.insert(mp.find(7), T3(6, "right hint")), false) << std::endl;
+	std::cout << "hint: " << printPair(mp.insert(mp.end(), T3(20, "end")), false) << std::endl;
+	printSize(mp);
+	return (0);
+}
@@ -0,0 +1,60 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 foo<int>
+typedef _flat_map<T1, T2>::value_type T3;
+typedef _flat_map<T1, T2>::iterator iterator;
+typedef _flat_map<T1, T2>::const_iterator const_iterator;
+typedef _flat_map<T1, T2>::reverse_iterator reverse_iterator;
+typedef _flat_map<T1, T2>::const_reverse_iterator const_reverse_iterator;
+
+int		main(void)
+{
+	_flat_map<T1, T2>	mp;
+
+	std::cout << "empty: " << (mp.begin() == mp.end()) << (mp.rbegin() == mp.rend()) << std::endl;
+	for (int i = 0; i < 20; ++i)
+		mp[(i * 7) % 20] = i * 10;
+
+	// the proxy reference: key and value live in separate arrays
+	iterator	it = mp.begin();
+
+	std::cout << "*it: " << (*it).first << " " << (*it).second << std::endl;
+	(*it).second = 1000;
+	it->second.m();
+	it->second = 2000;
+	std::cout << "it->: " << it->first << " " << it->second << std::endl;
+	T3			copy = *it;
+	std::cout << "copy: " << copy.first << " " << copy.second << std::endl;
+	(*it).second = 0;
+	std::cout << "copy unchanged: " << copy.second << " | element: " << it->second << std::endl;
+
+	// random access for ft, walked for std
+	iterator	it2 = ahead(mp.begin(), 5), it3 = behind(mp.end(), 3);
+	std::cout << "forward: " << printPair(it2, false) << " | backward: " << printPair(it3, false) << std::endl;
+	std::cout << "distance: " << between(it2, it3) << " " << between(mp.begin(), mp.end()) << std::endl;
+	std::cout << "relational: " << (it2 == it2) << (it2 != it3) << (it2 == ahead(mp.begin(), 5)) << std::endl;
+	std::cout << "post: " << printPair(it2++, false) << " | " << printPair(it2--, false)
+		<< " | " << printPair(it2, false) << std::endl;
+	--it2;
+	it2->second.m();
+
+	// const iterators from iterators, compared across constness
+	const_iterator	cit = it2, cite = mp.end();
+	std::cout << "const: " << (cit == it2) << (it2 == cit) << (cite == mp.end()) << std::endl;
+	cit->second.m();
+	for (int i = 0; cit != cite; ++cit, ++i)
+		std::cout << "[" << i << "] " << printPair(cit, false) << std::endl;
+
+	// reverse iterators go through the proxy pointer too
+	reverse_iterator		rit = mp.rbegin(), rite = mp.rend();
+	const_reverse_iterator	crit = mp.rbegin();
+
+	rit->second = 4242;
+	for (; rit != rite; ++rit)
+		std::cout << "r " << rit->first << " " << (*rit).second << std::endl;
+	std::cout << "crbegin: " << crit->first << " " << (*crit).second << std::endl;
+	std::cout << "base: " << printPair(--mp.rbegin().base(), false) << std::endl;
+	printSize(mp);
+	return (0);
+}
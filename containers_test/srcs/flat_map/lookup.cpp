@@ -0,0 +1,66 @@
+#include "common.hpp"
+#include <stdexcept>
+
+#define T1 int
+#define T2 int
+typedef _flat_map<T1, T2>::value_type T3;
+
+static void	cmp(const _flat_map<T1, T2> &lhs, const _flat_map<T1, T2> &rhs)
+{
+	static int i = 0;
+
+	std::cout << "############### [" << i++ << "] ###############"  << std::endl;
+	std::cout << "eq: " << (lhs == rhs) << " | ne: " << (lhs != rhs) << std::endl;
+	std::cout << "lt: " << (lhs <  rhs) << " | le: " << (lhs <= rhs) << std::endl;
+	std::cout << "gt: " << (lhs >  rhs) << " | ge: " << (lhs >= rhs) << std::endl;
+}
+
+int		main(void)
+{
+	_flat_map<T1, T2>	mp;
+
+	for (int i = 0; i < 200; ++i)
+		mp[(i * 37) % 200 * 5] = i;
+
+	const _flat_map<T1, T2>	&cmp_ref = mp;
+	for (int k = -3; k < 1003; k += 17) {
+		_flat_map<T1, T2>::const_iterator lb = cmp_ref.lower_bound(k), ub = cmp_ref.upper_bound(k);
+		_pair<_flat_map<T1, T2>::iterator, _flat_map<T1, T2>::iterator> range = mp.equal_range(k);
+
+		std::cout << "[" << k << "] lower: " << (lb == mp.end() ? -1 : lb->first)
+			<< " | upper: " << (ub == mp.end() ? -1 : ub->first)
+			<< " | range: " << (range.first == lb) << (range.second == ub)
+			<< " | find: " << (mp.find(k) == mp.end() ? -1 : mp.find(k)->second)
+			<< " | count: " << mp.count(k) << std::endl;
+	}
+	try {
+		std::cout << "at: " << mp.at(500) << std::endl;
+		mp.at(501);
+	}
+	catch (std::out_of_range &e) {
+		std::cout << "at: out_of_range" << std::endl;
+	}
+	mp.at(500) = 42;
+	mp[501] = 43;
+	mp[-1];
+	std::cout << "at: " << cmp_ref.at(500) << " | []: " << mp[501] << " " << mp[-1] << " | size: " << mp.size() << std::endl;
+
+	// copies, swap and relational operators
+	_flat_map<T1, T2>	copy(mp), other;
+
+	cmp(mp, copy);
+	copy[-1] = 1;
+	cmp(mp, copy);
+	other = copy;
+	other.erase(--other.end());
+	cmp(copy, other);
+	other.swap(copy);
+	cmp(copy, other);
+	swap(copy, mp);
+	cmp(mp, copy);
+	printSize(_flat_map<T1, T2>(mp.begin(), ahead(mp.begin(), 10)));
+	mp.clear();
+	std::cout << "empty: " << mp.empty() << std::endl;
+	cmp(mp, other);
+	return (0);
+}
@@ -0,0 +1,53 @@
+#include "common.hpp"
+#include <vector>
+
+#define T1 int
+#define T2 int
+typedef _flat_map<T1, T2>::value_type T3;
+
+int		main(void)
+{
+	std::vector<T3>	sorted;
+
+	for (int i = 0; i < 20; ++i)
+		sorted.push_back(T3(i * 3, i));
+
+	// taken as is, no sort and no merge
+	_flat_map<T1, T2>	mp = fromSorted<_flat_map<T1, T2> >(sorted.begin(), sorted.end());
+	printSize(mp);
+	std::cout << "find: " << printPair(mp.find(27), false) << " | lower_bound(28): "
+		<< printPair(mp.lower_bound(28), false) << std::endl;
+
+	// merged with the current elements: keys already there are kept
+	std::vector<T3>	more;
+	for (int i = 0; i < 20; ++i)
+		more.push_back(T3(i * 2, -i));
+	insertSorted(mp, more.begin(), more.end());
+	printSize(mp);
+
+	// empty ranges, and a range before or after everything
+	_flat_map<T1, T2>	empty = fromSorted<_flat_map<T1, T2> >(sorted.begin(), sorted.begin());
+	printSize(empty);
+	insertSorted(empty, sorted.begin(), sorted.begin());
+	insertSorted(empty, sorted.begin(), ahead(sorted.begin(), 5));
+	printSize(empty);
+	more.clear();
+	more.push_back(T3(-10, 1));
+	more.push_back(T3(-5, 2));
+	insertSorted(empty, more.begin(), more.end());
+	more.clear();
+	more.push_back(T3(100, 3));
+	insertSorted(empty, more.begin(), more.end());
+	printSize(empty);
+
+	// a large one
+	std::vector<T3>	big;
+	for (int i = 0; i < 50000; ++i)
+		big.push_back(T3(i, i % 7));
+	_flat_map<T1, T2>	large = fromSorted<_flat_map<T1, T2> >(big.begin(), big.end());
+	long	sum = 0;
+	for (int k = -5; k < 50005; k += 13)
+		sum += large.count(k) ? large[k] : 0;
+	std::cout << "size: " << large.size() << " | sum: " << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,68 @@
+#include "../base.hpp"
+#include <iterator>
+#if !defined(USING_STD)
+# include "flat_set.hpp"
+# define _flat_set ft::flat_set
+#else
+# include <set>
+# define _flat_set std::set
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "value: " << *iterator;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+// max_size is left out: flat_set's is the one of its vector
+template <typename T_SET>
+void	printSize(T_SET const &st, bool print_content = 1)
+{
+	std::cout << "size: " << st.size() << std::endl;
+	if (print_content)
+	{
+		typename T_SET::const_iterator it = st.begin(), ite = st.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// flat_set iterators are random access, std::set's bidirectional: ft
+// uses the operators, std walks
+template <typename It>
+It		ahead(It it, int n)
+{
+#if !defined(USING_STD)
+	return (it + n);
+#else
+	return (inc(it, n));
+#endif /* !defined(STD) */
+}
+
+// A range sorted without equivalent keys, tagged sorted_unique for ft
+template <typename T_SET, typename It>
+T_SET	fromSorted(It first, It last)
+{
+#if !defined(USING_STD)
+	return (T_SET(ft::sorted_unique, first, last));
+#else
+	return (T_SET(first, last));
+#endif /* !defined(STD) */
+}
+
+template <typename T_SET, typename It>
+void	insertSorted(T_SET &st, It first, It last)
+{
+#if !defined(USING_STD)
+	st.insert(ft::sorted_unique, first, last);
+#else
+	st.insert(first, last);
+#endif /* !defined(STD) */
+}
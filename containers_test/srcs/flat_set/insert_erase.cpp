@@ -0,0 +1,59 @@
+#include "common.hpp"
+#include <list>
+
+#define T1 int
+
+int		main(void)
+{
+	// one bulk insertion: sorted, duplicates dropped
+	std::list<T1> lst;
+	for (int i = 0; i < 40; ++i)
+		lst.push_back((i * 11) % 17);
+	_flat_set<T1>	st(lst.begin(), lst.end());
+	printSize(st);
+
+	// merged into the current elements
+	lst.clear();
+	for (int i = 30; i > 10; i -= 3)
+		lst.push_back(i);
+	st.insert(lst.begin(), lst.end());
+	printSize(st);
+
+	_pair<_flat_set<T1>::iterator, bool> ret = st.insert(100);
+	std::cout << "insert: " << *ret.first << " " << ret.second << " | again: " << st.insert(100).second << std::endl;
+	std::cout << "hint: " << *st.insert(st.find(12), 11) << " " << *st.insert(st.begin(), 50) << std::endl;
+	std::cout << "find: " << *st.find(24) << " | count: " << st.count(24) << st.count(25) << std::endl;
+	std::cout << "bounds: " << *st.lower_bound(25) << " " << *st.upper_bound(24) << std::endl;
+	printSize(st);
+
+	// ranges: in the middle, at both ends, then everything
+	st.erase(ahead(st.begin(), 5), ahead(st.begin(), 9));
+	printSize(st);
+	st.erase(st.begin(), ahead(st.begin(), 2));
+	st.erase(st.lower_bound(20), st.end());
+	printSize(st);
+	st.erase(st.begin());
+	std::cout << "by key: " << st.erase(9) << st.erase(9) << std::endl;
+	printSize(st);
+	st.erase(st.begin(), st.end());
+	printSize(st);
+
+	// large, scattered
+	_flat_set<T1>	big;
+	for (int i = 0; i < 4000; ++i)
+		lst.push_back((i * 7919) % 2000);
+	big.insert(lst.begin(), lst.end());
+	for (int i = 0; i < 2000; i += 3)
+		big.erase(i);
+	long	sum = 0;
+	for (_flat_set<T1>::iterator it = big.begin(); it != big.end(); ++it)
+		sum += *it;
+	std::cout << "size: " << big.size() << " | sum: " << sum << std::endl;
+
+	_flat_set<T1>	copy(big), other;
+	other = copy;
+	std::cout << "eq: " << (copy == big) << (other == big) << (other < big) << std::endl;
+	other.swap(st);
+	printSize(other);
+	return (0);
+}
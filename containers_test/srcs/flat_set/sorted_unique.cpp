@@ -0,0 +1,29 @@
+#include "common.hpp"
+#include <vector>
+
+#define T1 int
+
+int		main(void)
+{
+	std::vector<T1>	sorted;
+
+	for (int i = 0; i < 20; ++i)
+		sorted.push_back(i * 3);
+
+	_flat_set<T1>	st = fromSorted<_flat_set<T1> >(sorted.begin(), sorted.end());
+	printSize(st);
+
+	std::vector<T1>	more;
+	for (int i = 0; i < 20; ++i)
+		more.push_back(i * 2 - 5);
+	insertSorted(st, more.begin(), more.end());
+	printSize(st);
+
+	_flat_set<T1>	empty = fromSorted<_flat_set<T1> >(sorted.begin(), sorted.begin());
+	insertSorted(empty, sorted.begin(), sorted.begin());
+	printSize(empty);
+	insertSorted(empty, ahead(sorted.begin(), 15), sorted.end());
+	insertSorted(empty, sorted.begin(), ahead(sorted.begin(), 3));
+	printSize(empty);
+	return (0);
+}
@@ -0,0 +1,45 @@
+#include "common.hpp"
+
+// Keys with the same hash share a home slot: a run grows, later keys are
+// displaced past values closer to their own home, and lookups of missing
+// keys stop early along the run
+struct by_sixteen {
+	size_t	operator()(int k) const { return static_cast<size_t>(k >> 4); }
+};
+struct low_bits_dropped {
+	size_t	operator()(int k) const { return static_cast<size_t>(k & ~1023); }
+};
+
+int		main(void)
+{
+	_unordered_map<int, int, by_sixteen>::type	mp;
+
+	// groups of sixteen, inserted out of order so displacement kicks in
+	for (int i = 0; i < 6000; ++i)
+		mp[(i * 7919) % 6000] = i;
+	printSize(mp, false);
+	printLookup(mp, -20, 6020);
+	printPolicy(mp);
+
+	// holes in every run, then fill them again
+	for (int k = 0; k < 6000; k += 5)
+		mp.erase(k);
+	printLookup(mp, -20, 6020);
+	for (int k = 0; k < 6000; k += 10)
+		mp[k] = -k;
+	printSize(mp, false);
+	printLookup(mp, -20, 6020);
+
+	// 1024 keys per home slot, a run far longer than any group of keys
+	_unordered_map<int, int, low_bits_dropped>::type	wide;
+
+	for (int i = 0; i < 3000; ++i)
+		wide[i] = i;
+	printSize(wide, false);
+	printLookup(wide, -10, 3010);
+	for (int i = 0; i < 3000; i += 2)
+		wide.erase(i);
+	printSize(wide, false);
+	printLookup(wide, -10, 3010);
+	return (0);
+}
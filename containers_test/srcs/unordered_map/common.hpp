@@ -0,0 +1,123 @@
+#include "../base.hpp"
+#include <map>
+#if !defined(USING_STD)
+# include "unordered_map.hpp"
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+// ft::unordered_map<K, T, H>, compared against a std::map: std::unordered_map
+// is C++11, and its iteration order is not ft's anyway. H is dropped there
+#if !defined(USING_STD)
+template <typename K, typename T, typename H = ft::hash<K> >
+struct _unordered_map { typedef ft::unordered_map<K, T, H>	type; };
+#else
+template <typename K, typename T, typename H = void>
+struct _unordered_map { typedef std::map<K, T>	type; };
+#endif /* !defined(STD) */
+
+// Size, how many elements the iterators visit, and the content sorted by key
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	std::map<typename T_MAP::key_type, typename T_MAP::mapped_type>	sorted;
+	typename T_MAP::const_iterator it = mp.begin(), ite = mp.end();
+	size_t	n = 0;
+
+	for (; it != ite; ++it, ++n)
+		sorted.insert(std::make_pair(it->first, it->second));
+	std::cout << "size: " << mp.size() << " | iterated: " << n << " | distinct: " << sorted.size() << std::endl;
+	if (print_content)
+	{
+		typename std::map<typename T_MAP::key_type, typename T_MAP::mapped_type>::iterator sit = sorted.begin();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; sit != sorted.end(); ++sit)
+			std::cout << "- key: " << sit->first << " | value: " << sit->second << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// Looks up every key in [first, last): how many are found, the sum of their
+// values and whether each found element has the key that was asked for
+template <typename T_MAP>
+void	printLookup(T_MAP const &mp, int first, int last)
+{
+	size_t	found = 0, count = 0;
+	long	sum = 0;
+	bool	right = true;
+
+	for (int k = first; k < last; ++k) {
+		typename T_MAP::const_iterator it = mp.find(k);
+
+		count += mp.count(k);
+		if (it == mp.end())
+			continue ;
+		++found;
+		sum += it->second;
+		right = right && it->first == k;
+	}
+	std::cout << "lookup [" << first << ", " << last << "): found: " << found << " | count: " << count
+		<< " | sum: " << sum << " | keys: " << right << std::endl;
+}
+
+// The hash policy has no std::map counterpart: ft prints whether its
+// invariants hold after each call, std prints that they do
+template <typename T_MAP>
+void	printPolicy(T_MAP const &mp)
+{
+#if !defined(USING_STD)
+	size_t	n = mp.bucket_count();
+
+	std::cout << "buckets: power of two: " << ((n & (n - 1)) == 0) << " | enough: " << (n >= mp.size())
+		<< " | under max load: " << (mp.load_factor() <= mp.max_load_factor()) << std::endl;
+#else
+	(void)mp;
+	std::cout << "buckets: power of two: 1 | enough: 1 | under max load: 1" << std::endl;
+#endif /* !defined(STD) */
+}
+
+template <typename T_MAP>
+void	doRehash(T_MAP &mp, size_t n)
+{
+#if !defined(USING_STD)
+	mp.rehash(n);
+	std::cout << "rehash(" << n << "): " << (mp.bucket_count() >= n) << std::endl;
+#else
+	(void)mp;
+	std::cout << "rehash(" << n << "): 1" << std::endl;
+#endif /* !defined(STD) */
+	printPolicy(mp);
+}
+
+template <typename T_MAP>
+void	doReserve(T_MAP &mp, size_t n)
+{
+#if !defined(USING_STD)
+	size_t	before;
+
+	mp.reserve(n);
+	before = mp.bucket_count();
+	while (mp.size() < n)
+		mp[-1 - static_cast<int>(mp.size())];
+	std::cout << "reserve(" << n << "): no growth: " << (mp.bucket_count() == before) << std::endl;
+#else
+	while (mp.size() < n)
+		mp[-1 - static_cast<int>(mp.size())];
+	std::cout << "reserve(" << n << "): no growth: 1" << std::endl;
+#endif /* !defined(STD) */
+	printPolicy(mp);
+}
+
+// ml is clamped to [0.125, 1]
+template <typename T_MAP>
+void	doMaxLoad(T_MAP &mp, float ml, float expected)
+{
+#if !defined(USING_STD)
+	mp.max_load_factor(ml);
+	std::cout << "max_load_factor(" << ml << "): " << (mp.max_load_factor() == expected) << std::endl;
+#else
+	(void)mp; (void)expected;
+	std::cout << "max_load_factor(" << ml << "): 1" << std::endl;
+#endif /* !defined(STD) */
+	printPolicy(mp);
+}
@@ -0,0 +1,59 @@
+#include "common.hpp"
+
+typedef _unordered_map<int, std::string>::type map_type;
+
+static void	cmp(const map_type &lhs, const map_type &rhs)
+{
+	static int i = 0;
+
+	std::cout << "############### [" << i++ << "] ###############"  << std::endl;
+	std::cout << "eq: " << (lhs == rhs) << " | ne: " << (lhs != rhs) << std::endl;
+}
+
+int		main(void)
+{
+	map_type	mp;
+
+	for (int i = 0; i < 2000; ++i)
+		mp[(i * 7919) % 2000] = std::string(i % 7 + 1, 'a' + i % 26);
+
+	map_type	copy(mp), assigned, small;
+
+	assigned = copy;
+	printSize(copy, false);
+	printSize(assigned, false);
+	cmp(mp, copy);
+	copy.erase(700);
+	assigned[700] = "changed";
+	cmp(mp, copy);
+	cmp(mp, assigned);
+	std::cout << "mp[700]: " << mp[700] << " | assigned[700]: " << assigned[700] << std::endl;
+
+	small[1] = "one";
+	small[2] = "two";
+	assigned = small;
+	printSize(assigned);
+	cmp(assigned, small);
+
+	// same elements inserted in another order are equal
+	map_type	reversed;
+	for (int i = 1999; i >= 0; --i)
+		reversed[i] = mp[i];
+	cmp(mp, reversed);
+
+	mp.swap(small);
+	printSize(mp);
+	printSize(small, false);
+	swap(mp, small);
+	printSize(mp, false);
+	cmp(mp, reversed);
+
+	mp.clear();
+	std::cout << "empty: " << mp.empty() << std::endl;
+	printSize(mp);
+	mp[3] = "three";
+	printSize(mp);
+	mp = reversed;
+	cmp(mp, reversed);
+	return (0);
+}
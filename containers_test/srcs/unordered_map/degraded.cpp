@@ -0,0 +1,54 @@
+#include "common.hpp"
+
+// More keys share a home slot than a probe distance byte can count: the
+// table stops keeping runs in order and scans, until a rehash restores them
+struct same {
+	size_t	operator()(int) const { return 0; }
+};
+struct by_thousand {
+	size_t	operator()(int k) const { return static_cast<size_t>(k / 1000); }
+};
+
+int		main(void)
+{
+	_unordered_map<int, int, by_thousand>::type	thousand;
+
+	// keys 0..255 all hash to 0
+	for (int i = 0; i <= 255; ++i)
+		thousand[i] = i;
+	printSize(thousand, false);
+	printLookup(thousand, -5, 300);
+	for (int i = 256; i < 3000; ++i)
+		thousand[i] = i;
+	printLookup(thousand, -5, 3005);
+
+	_unordered_map<int, int, same>::type	mp;
+
+	for (int i = 0; i < 600; ++i)
+		mp[i * 3] = i;
+	printSize(mp, false);
+	printLookup(mp, -3, 1803);
+
+	// erasing and inserting while degraded
+	for (int k = 0; k < 1800; k += 6)
+		mp.erase(k);
+	printLookup(mp, -3, 1803);
+	for (int k = 1; k < 1800; k += 9)
+		mp[k] = -k;
+	printSize(mp, false);
+	printLookup(mp, -3, 1803);
+
+	// a rehash, copies and clear() keep every element reachable
+	doRehash(mp, 4096);
+	printLookup(mp, -3, 1803);
+	_unordered_map<int, int, same>::type	copy(mp);
+	printLookup(copy, -3, 1803);
+	mp.clear();
+	printSize(mp);
+	for (int i = 0; i < 100; ++i)
+		mp[i] = i;
+	printSize(mp, false);
+	printLookup(mp, -3, 103);
+	printLookup(copy, -3, 1803);
+	return (0);
+}
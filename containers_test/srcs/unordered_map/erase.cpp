@@ -0,0 +1,72 @@
+#include "common.hpp"
+
+// Eight keys share each home slot: erasing from the middle of a run pulls
+// the rest of it back one slot
+struct by_eight {
+	size_t	operator()(int k) const { return static_cast<size_t>(k / 8); }
+};
+
+typedef _unordered_map<int, int, by_eight>::type map_type;
+typedef map_type::value_type T3;
+
+int		main(void)
+{
+	const int	n = 4000;
+	map_type	mp;
+
+	for (int i = 0; i < n; ++i)
+		mp.insert(T3(i, i * 2));
+	printSize(mp, false);
+	printLookup(mp, -8, n + 8);
+
+	// by key, every third one, then some that are missing
+	size_t	erased = 0;
+	for (int k = 0; k < n; k += 3)
+		erased += mp.erase(k);
+	std::cout << "erased: " << erased << " | missing: " << mp.erase(0) << mp.erase(n) << std::endl;
+	printSize(mp, false);
+	printLookup(mp, -8, n + 8);
+
+	// through iterators: the element found for a key, and begin()
+	for (int k = 1; k < n; k += 7) {
+		map_type::iterator it = mp.find(k);
+
+		if (it != mp.end())
+			mp.erase(it);
+	}
+	printSize(mp, false);
+	printLookup(mp, -8, n + 8);
+	while (mp.size() > n / 2)
+		mp.erase(mp.begin());
+	printSize(mp, false);
+
+	// a range of the whole table clears it
+	mp.erase(mp.begin(), mp.end());
+	printSize(mp);
+
+	// churn: a window of keys slides over the table
+	for (int i = 0; i < 20000; ++i) {
+		mp[i] = i;
+		if (i >= 500)
+			mp.erase(i - 500);
+		if (i % 2500 == 0)
+			printLookup(mp, i - 600, i + 1);
+	}
+	printSize(mp, false);
+	printLookup(mp, 19000, 20000);
+
+	// a partial range: what it holds is the only thing guaranteed
+	map_type	small;
+	for (int i = 0; i < 10; ++i)
+		small[i] = i;
+	map_type::iterator first = small.begin(), last = first;
+	int		sum = 0;
+	for (int i = 0; i < 4; ++i, ++last)
+		sum += last->second;
+	small.erase(first, last);
+	std::cout << "partial range: " << small.size() << " | sum left: ";
+	for (map_type::iterator it = small.begin(); it != small.end(); ++it)
+		sum += it->second;
+	std::cout << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,77 @@
+#include "common.hpp"
+#include <stdexcept>
+
+// Copying throws once armed; in C++11 the table moves the values it shifts
+// (noexcept), in C++98 it copies them, so the throw can hit either the new
+// value or one on its way
+static int	armed = 0;
+
+class thrower {
+	public:
+		thrower(int v = 0) : value(v) { };
+		thrower(thrower const &src) : value(src.value) {
+			if (armed) {
+				armed = 0;
+				throw std::runtime_error("thrower copy");
+			}
+		};
+#if __cplusplus >= 201103L
+		thrower(thrower &&src) noexcept : value(src.value) { };
+		thrower &operator=(thrower &&src) noexcept { value = src.value; return *this; };
+#endif
+		thrower &operator=(thrower const &src) { value = src.value; return *this; };
+		int		value;
+};
+
+struct by_four {
+	size_t	operator()(int k) const { return static_cast<size_t>(k / 4); }
+};
+
+typedef _unordered_map<int, thrower, by_four>::type map_type;
+typedef map_type::value_type T3;
+
+static void	printValues(map_type const &mp, int first, int last)
+{
+	size_t	found = 0;
+	long	sum = 0;
+
+	for (int k = first; k < last; ++k) {
+		map_type::const_iterator it = mp.find(k);
+
+		if (it != mp.end() && it->first == k) {
+			++found;
+			sum += it->second.value;
+		}
+	}
+	std::cout << "size: " << mp.size() << " | found: " << found << " | sum: " << sum << std::endl;
+}
+
+int		main(void)
+{
+	map_type	base;
+	int			caught = 0;
+
+	for (int i = 0; i < 500; ++i)
+		base.insert(T3(i * 2, thrower(i)));
+
+	// a failed insert leaves the other values reachable, then succeeds
+	for (int k = -1; k < 1001; k += 2)
+	{
+		map_type	mp(base);
+		T3			val(k, thrower(k));
+
+		armed = 1;
+		try {
+			mp.insert(val);
+		}
+		catch (std::runtime_error &e) {
+			++caught;
+		}
+		armed = 0;
+		printValues(mp, -1, 1001);
+		mp.insert(val);
+		printValues(mp, -1, 1001);
+	}
+	std::cout << "caught: " << caught << std::endl;
+	return (0);
+}
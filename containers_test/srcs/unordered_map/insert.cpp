@@ -0,0 +1,68 @@
+#include "common.hpp"
+#include <list>
+#include <stdexcept>
+
+typedef _unordered_map<int, std::string>::type map_type;
+typedef map_type::value_type T3;
+
+static int iter = 0;
+
+void	ft_insert(map_type &mp, T3 const &val)
+{
+	_pair<map_type::iterator, bool> ret = mp.insert(val);
+
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	std::cout << "insert return: key: " << ret.first->first << " | value: " << ret.first->second;
+	std::cout << " | Created: " << ret.second << std::endl;
+	printSize(mp);
+}
+
+int		main(void)
+{
+	map_type	mp;
+
+	std::cout << "empty: " << mp.empty() << " | begin == end: " << (mp.begin() == mp.end()) << std::endl;
+	ft_insert(mp, T3(42, "lol"));
+	ft_insert(mp, T3(42, "mdr"));
+	ft_insert(mp, T3(50, "mdr"));
+	ft_insert(mp, T3(35, "funny"));
+	ft_insert(mp, T3(-45, "bunny"));
+	ft_insert(mp, T3(0, "zero"));
+	std::cout << "hint: " << mp.insert(mp.begin(), T3(7, "hint"))->second << std::endl;
+	std::cout << "hint: " << mp.insert(mp.end(), T3(42, "dup"))->second << std::endl;
+
+	// operator[] inserts a value-initialized element only when k is missing
+	mp[1] = "one";
+	mp[42] += "!";
+	std::cout << "mp[2]: [" << mp[2] << "]" << std::endl;
+	std::cout << "at(50): " << mp.at(50) << std::endl;
+	try {
+		mp.at(51);
+	}
+	catch (std::out_of_range &e) {
+		std::cout << "at(51): out_of_range" << std::endl;
+	}
+	std::cout << "find(35): " << mp.find(35)->second << " | find(36) == end: " << (mp.find(36) == mp.end()) << std::endl;
+	std::cout << "count: " << mp.count(35) << mp.count(36) << std::endl;
+	_pair<map_type::iterator, map_type::iterator> range = mp.equal_range(35), none = mp.equal_range(36);
+	std::cout << "equal_range: " << range.first->second << " " << (++range.first == range.second)
+		<< " | missing: " << (none.first == none.second) << std::endl;
+	printSize(mp);
+
+	// range, with duplicates: the first one stays
+	std::list<T3> lst;
+	for (int i = 0; i < 40; ++i)
+		lst.push_back(T3((i * 7) % 23, std::string(i % 5 + 1, 'a' + i % 26)));
+	map_type	mp2(lst.begin(), lst.end());
+	printSize(mp2);
+
+	// growing from empty through many rehashes
+	_unordered_map<int, int>::type	big;
+
+	for (int i = 0; i < 100000; ++i)
+		big.insert(_pair<const int, int>((i * 7919) % 100000 - 50000, i));
+	printSize(big, false);
+	printLookup(big, -50010, 50010);
+	printPolicy(big);
+	return (0);
+}
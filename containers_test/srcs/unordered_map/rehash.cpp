@@ -0,0 +1,44 @@
+#include "common.hpp"
+
+typedef _unordered_map<int, int>::type map_type;
+
+int		main(void)
+{
+	map_type	mp;
+
+	printPolicy(mp);
+	for (int i = 0; i < 1000; ++i)
+		mp[i * 13] = i;
+	printPolicy(mp);
+
+	// growing and shrinking the slot array keeps every element
+	doRehash(mp, 5000);
+	printLookup(mp, -13, 13013);
+	doRehash(mp, 0);
+	printLookup(mp, -13, 13013);
+	doRehash(mp, 3);
+	printSize(mp, false);
+
+	// the load factor bound, clamped to [0.125, 1]
+	doMaxLoad(mp, 0.5f, 0.5f);
+	printLookup(mp, -13, 13013);
+	doMaxLoad(mp, 1.0f, 1.0f);
+	doMaxLoad(mp, 0.05f, 0.125f);
+	printLookup(mp, -13, 13013);
+	doMaxLoad(mp, 4.0f, 1.0f);
+	for (int i = 1000; i < 3000; ++i)
+		mp[i * 13] = i;
+	printPolicy(mp);
+	printLookup(mp, -13, 39013);
+
+	// reserve(n) makes room for n elements without growing
+	map_type	res;
+
+	doReserve(res, 1000);
+	doReserve(res, 50000);
+	printSize(res, false);
+	doMaxLoad(res, 0.25f, 0.25f);
+	doReserve(res, 60000);
+	printSize(res, false);
+	return (0);
+}
@@ -0,0 +1,45 @@
+#include "common.hpp"
+
+// Keys sharing a home slot: long runs, displacement and pull back on
+// erasure, then more keys per slot than a probe distance byte can count
+struct by_eight {
+	size_t	operator()(int k) const { return static_cast<size_t>(k / 8); }
+};
+struct same {
+	size_t	operator()(int) const { return 0; }
+};
+
+int		main(void)
+{
+	_unordered_set<int, by_eight>::type	st;
+
+	for (int i = 0; i < 8000; ++i)
+		st.insert((i * 7919) % 8000);
+	printSize(st, false);
+	printLookup(st, -10, 8010);
+	for (int k = 0; k < 8000; k += 3)
+		st.erase(k);
+	printLookup(st, -10, 8010);
+	for (int k = 0; k < 8000; k += 6)
+		st.insert(k);
+	printSize(st, false);
+	printLookup(st, -10, 8010);
+
+	_unordered_set<int, same>::type	deg;
+
+	for (int i = 0; i < 700; ++i)
+		deg.insert(i * 2);
+	printSize(deg, false);
+	printLookup(deg, -2, 1402);
+	for (int k = 0; k < 1400; k += 4)
+		deg.erase(k);
+	for (int k = 1; k < 1400; k += 10)
+		deg.insert(k);
+	printSize(deg, false);
+	printLookup(deg, -2, 1402);
+	deg.clear();
+	for (int i = 0; i < 50; ++i)
+		deg.insert(i);
+	printSize(deg);
+	return (0);
+}
@@ -0,0 +1,61 @@
+#include "../base.hpp"
+#include <set>
+#if !defined(USING_STD)
+# include "unordered_set.hpp"
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+// ft::unordered_set<K, H>, compared against a std::set: std::unordered_set
+// is C++11, and its iteration order is not ft's anyway. H is dropped there
+#if !defined(USING_STD)
+template <typename K, typename H = ft::hash<K> >
+struct _unordered_set { typedef ft::unordered_set<K, H>	type; };
+#else
+template <typename K, typename H = void>
+struct _unordered_set { typedef std::set<K>	type; };
+#endif /* !defined(STD) */
+
+// Size, how many elements the iterators visit, and the content sorted
+template <typename T_SET>
+void	printSize(T_SET const &st, bool print_content = 1)
+{
+	std::set<typename T_SET::key_type>	sorted;
+	typename T_SET::const_iterator it = st.begin(), ite = st.end();
+	size_t	n = 0;
+
+	for (; it != ite; ++it, ++n)
+		sorted.insert(*it);
+	std::cout << "size: " << st.size() << " | iterated: " << n << " | distinct: " << sorted.size() << std::endl;
+	if (print_content)
+	{
+		typename std::set<typename T_SET::key_type>::iterator sit = sorted.begin();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; sit != sorted.end(); ++sit)
+			std::cout << "- value: " << *sit << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// Looks up every key in [first, last): how many are found, their sum and
+// whether each found element is the key that was asked for
+template <typename T_SET>
+void	printLookup(T_SET const &st, int first, int last)
+{
+	size_t	found = 0, count = 0;
+	long	sum = 0;
+	bool	right = true;
+
+	for (int k = first; k < last; ++k) {
+		typename T_SET::const_iterator it = st.find(k);
+
+		count += st.count(k);
+		if (it == st.end())
+			continue ;
+		++found;
+		sum += *it;
+		right = right && *it == k;
+	}
+	std::cout << "lookup [" << first << ", " << last << "): found: " << found << " | count: " << count
+		<< " | sum: " << sum << " | keys: " << right << std::endl;
+}
@@ -0,0 +1,57 @@
+#include "common.hpp"
+#include <list>
+
+typedef _unordered_set<int>::type set_type;
+
+int		main(void)
+{
+	set_type	st;
+
+	std::cout << "insert: " << *st.insert(42).first << st.insert(42).second << st.insert(21).second << std::endl;
+	std::cout << "hint: " << *st.insert(st.begin(), 7) << *st.insert(st.end(), 42) << std::endl;
+	printSize(st);
+
+	std::list<int> lst;
+	for (int i = 0; i < 50; ++i)
+		lst.push_back((i * 11) % 17);
+	set_type	st2(lst.begin(), lst.end());
+	printSize(st2);
+
+	// growth, then erasure by key, by iterator and by range
+	set_type	big;
+
+	for (int i = 0; i < 50000; ++i)
+		big.insert((i * 7919) % 50000);
+	printSize(big, false);
+	printLookup(big, -10, 50010);
+	size_t	erased = 0;
+	for (int k = 0; k < 50000; k += 4)
+		erased += big.erase(k);
+	std::cout << "erased: " << erased << " | missing: " << big.erase(0) << big.erase(-1) << std::endl;
+	printLookup(big, -10, 50010);
+	for (int k = 1; k < 50000; k += 9) {
+		set_type::iterator it = big.find(k);
+
+		if (it != big.end())
+			big.erase(it);
+	}
+	printSize(big, false);
+	printLookup(big, -10, 50010);
+	while (big.size() > 1000)
+		big.erase(big.begin());
+	printSize(big, false);
+	big.erase(big.begin(), big.end());
+	printSize(big);
+
+	// copies, swap and equality
+	set_type	copy(st2), other;
+
+	other = st;
+	std::cout << "eq: " << (copy == st2) << (other == st) << (copy == st) << (copy != st) << std::endl;
+	copy.swap(other);
+	printSize(copy);
+	printSize(other);
+	copy.clear();
+	printSize(copy);
+	return (0);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   counting_allocator.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:06:20 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:10:09 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COUNTING_ALLOCATOR_HPP
+# define COUNTING_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <new>
+# include <limits>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
+namespace ft {
+	//ALLOCATION STATISTICS
+		// What a counting_allocator and all its copies and rebound copies
+		// did: calls, bytes, and the most bytes held at once
+	struct allocation_stats {
+		std::size_t	allocations;
+		std::size_t	deallocations;
+		std::size_t	bytes;			// allocated in total
+		std::size_t	live_bytes;		// allocated and not freed yet
+		std::size_t	peak_bytes;		// high-water mark of live_bytes
+
+		allocation_stats() : allocations(0), deallocations(0), bytes(0), live_bytes(0), peak_bytes(0) { }
+		// Starts a new measurement: memory still held counts towards the peak
+		void	reset() {
+			allocations = 0;
+			deallocations = 0;
+			bytes = 0;
+			peak_bytes = live_bytes;
+		}
+	};
+		// Shared by every default constructed counting_allocator
+	inline allocation_stats&	default_allocation_stats() {
+		static allocation_stats	stats;
+
+		return stats;
+	}
+
+	//COUNTING ALLOCATOR
+		// Gets memory from operator new like std::allocator and records every
+		// call in an allocation_stats: the one given to the constructor, or
+		// default_allocation_stats().
+		// Copies and rebound copies share it, so the node allocator a tree
+		// rebinds to counts into the stats of the map or set using it.
+		// All instances compare equal: any of them can free memory from another
+	template <class T>
+	class counting_allocator {
+	public:
+		typedef T					value_type;
+		typedef T*					pointer;
+		typedef const T*			const_pointer;
+		typedef T&					reference;
+		typedef const T&			const_reference;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+		template <class U>
+		struct rebind {
+			typedef counting_allocator<U>	other;
+		};
+	private:
+		template <class U>
+		friend class counting_allocator;
+		allocation_stats*	_stats;
+	public:
+	// CONSTRUCTORS
+		counting_allocator() : _stats(&default_allocation_stats()) { }
+		explicit counting_allocator(allocation_stats& stats) : _stats(&stats) { }
+		counting_allocator(const counting_allocator& x) : _stats(x._stats) { }
+		template <class U>
+		counting_allocator(const counting_allocator<U>& x) : _stats(x._stats) { }
+		~counting_allocator() { }
+		counting_allocator& operator=(const counting_allocator& x) {
+			_stats = x._stats;
+			return *this;
+		}
+	// ALLOCATION
+		pointer	allocate(size_type n, const void* = 0) {
+			if (n > max_size())
+				throw std::bad_alloc();
+			pointer	p = static_cast<pointer>(::operator new(n * sizeof(T)));
+
+			_stats->allocations++;
+			_stats->bytes += n * sizeof(T);
+			_stats->live_bytes += n * sizeof(T);
+			if (_stats->live_bytes > _stats->peak_bytes)
+				_stats->peak_bytes = _stats->live_bytes;
+			return p;
+		}
+		void	deallocate(pointer p, size_type n) {
+			_stats->deallocations++;
+			_stats->live_bytes -= n * sizeof(T);
+			::operator delete(p);
+		}
+	// UTILS
+		void		construct(pointer p, const_reference val) { ::new(static_cast<void*>(p)) T(val); }
+# if __cplusplus >= 201103L
+		template <class U, class... Args>
+		void		construct(U* p, Args&&... args) { ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+# endif
+		void		destroy(pointer p) { p->~T(); }
+		pointer			address(reference x) const { return &x; }
+		const_pointer	address(const_reference x) const { return &x; }
+		size_type	max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+		allocation_stats&	stats() const { return *_stats; }
+		template <class U>
+		bool	operator==(const counting_allocator<U>&) const { return true; }
+		template <class U>
+		bool	operator!=(const counting_allocator<U>&) const { return false; }
+	};
+}
+
+#endif
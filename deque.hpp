@@ -0,0 +1,548 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:16:42 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:25:47 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef DEQUE_HPP
+# define DEQUE_HPP
+
+# include <stdexcept>
+# include <memory>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "iterators/DequeIterator.hpp"
+# include "algorithm.hpp"
+# include "type_traits.hpp"
+
+namespace ft {
+	// Elements live in fixed size blocks (deque_block_size) reached through a
+	// map of block pointers that keeps free slots at both ends: pushing or
+	// popping at either end never moves an element, so references to the
+	// others stay valid, and a full map only copies block pointers
+	template<class T, class Allocator = std::allocator<T> >
+	class deque {
+	public:
+		typedef	T											value_type;
+		typedef	Allocator									allocator_type;
+		typedef	typename allocator_type::size_type			size_type;
+		typedef typename allocator_type::difference_type	difference_type;
+		typedef	typename allocator_type::reference			reference;
+		typedef	typename allocator_type::const_reference	const_reference;
+		typedef	typename allocator_type::pointer			pointer;
+		typedef	typename allocator_type::const_pointer		const_pointer;
+		typedef	ft::DequeIterator<value_type>				iterator;
+		typedef	ft::DequeIterator<const value_type>			const_iterator;
+		typedef	ft::reverse_iterator<iterator>				reverse_iterator;
+		typedef	ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	protected:
+		typedef typename Allocator::template rebind<pointer>::other	map_allocator;
+		typedef pointer*											map_pointer;
+
+		map_pointer		_map;
+		size_type		_map_size;
+		iterator		_start;		// first element
+		iterator		_finish;	// past the last one, always inside an allocated block
+		allocator_type	_alloc;
+		map_allocator	_map_alloc;
+
+	public:
+	// ******CONSTRUCTORS******
+		// 1) Default
+		explicit deque ( const allocator_type& alloc = allocator_type() )
+						: _map(nullptr), _map_size(0), _alloc(alloc), _map_alloc(alloc) {
+			_dinit();
+		}
+		// 2) Fill
+		explicit deque ( size_type n, const value_type& val = value_type(),
+						const allocator_type& alloc = allocator_type() )
+							: _map(nullptr), _map_size(0), _alloc(alloc), _map_alloc(alloc) {
+			_dinit();
+			try {
+				_dfill_back(n, val);
+			}
+			catch (...) {
+				_ddestroy();
+				throw;
+			}
+		}
+		// 3) Range
+		template <class InputIterator>
+		deque ( InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL )
+				: _map(nullptr), _map_size(0), _alloc(alloc), _map_alloc(alloc) {
+			_dinit();
+			try {
+				_dappend(first, last);
+			}
+			catch (...) {
+				_ddestroy();
+				throw;
+			}
+		}
+		// 4) Copy
+		deque ( const deque& x ) : _map(nullptr), _map_size(0), _alloc(x._alloc), _map_alloc(x._map_alloc) {
+			_dinit();
+			try {
+				_dappend(x.begin(), x.end());
+			}
+			catch (...) {
+				_ddestroy();
+				throw;
+			}
+		}
+
+	// DESTRUCTOR
+		~deque() { _ddestroy(); }
+
+	// ASSIGN CONTENT
+		deque& operator=( const deque& x ) {
+			if (this != &x)
+				assign(x.begin(), x.end());
+			return *this;
+		}
+
+	// ASSIGN - Assigns new contents to the deque, replacing its current contents
+		// 1) Fill
+		void	assign(size_type count, const value_type& val) {
+			value_type	copy(val);
+
+			clear();
+			_dfill_back(count, copy);
+		}
+		// 2) Range
+		template <class InputIterator>
+		void	assign(InputIterator first, InputIterator last,
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL) {
+			clear();
+			_dappend(first, last);
+		}
+
+	// ALLOCATOR
+		// Returns the allocator associated with the container
+		allocator_type	get_allocator() const { return _alloc; }
+
+	// ELEMENT ACCESS
+		// 1) "at" - Returns a reference to the element at position n in the deque;
+		//    throws out_of_range("deque") like libc++, containers_test prints it
+		reference	at(size_type pos) {
+			if (pos >= size())
+				throw std::out_of_range("deque");
+			return _start[pos];
+		}
+		const_reference	at(size_type pos) const {
+			if (pos >= size())
+				throw std::out_of_range("deque");
+			return _start[pos];
+		}
+		// 2) "[]" - The same behavior as 'at' operator function, but no bounds checking is performed
+		reference		operator[](size_type pos)		{ return _start[pos]; }
+		const_reference	operator[](size_type pos) const	{ return _start[pos]; }
+		// 3) "front" - Returns a reference to the first element in the deque
+		reference 		front()							{ return *_start; }
+		const_reference front() const					{ return *_start; }
+		// 4) "back" - Returns a reference to the last element in the deque
+		reference		back() {
+			iterator	last = _finish;
+
+			return *--last;
+		}
+		const_reference	back() const {
+			iterator	last = _finish;
+
+			return *--last;
+		}
+
+	// ITERATORS
+		// 1) Begin - iterator pointing first element position
+		iterator				begin()			{ return _start; }
+		const_iterator 			begin() const	{ return _start; }
+		// 2) End - iterator pointing last element position
+		iterator				end()			{ return _finish; }
+		const_iterator			end() const 	{ return _finish; }
+		// 3) Reverse Begin - iterator pointing after the last element position
+		reverse_iterator		rbegin()		{ return reverse_iterator(_finish); }
+		const_reverse_iterator	rbegin() const	{ return const_reverse_iterator(_finish); }
+		// 4) Reverse End - iterator pointing first element position
+		reverse_iterator		rend()			{ return reverse_iterator(_start); }
+		const_reverse_iterator	rend() const	{ return const_reverse_iterator(_start); }
+
+	// CAPACITY FUNCTIONS
+		// 1) Checks if the current deque is empty
+		bool	empty() const {
+			return _finish == _start;
+		}
+		// 2) Size of the deque
+		size_type	size() const {
+			return static_cast<size_type>(_finish - _start);
+		}
+		// 3) Max possible size of the deque
+		size_type max_size() const {
+			return _alloc.max_size();
+		}
+
+	// MODIFIERS
+		// 1) Clearing deque, calling destructor to all members; keeps the
+		//    first block only
+		void	clear() {
+			_destroy_range(_start, _finish);
+			for (map_pointer node = _start.node() + 1; node <= _finish.node(); ++node)
+				_deallocate_block(*node);
+			_finish = _start;
+		}
+		// 2) Inserting value to the given position: the elements on the
+		//    shorter side of it are shifted
+			// a) Single Element
+		iterator	insert( iterator position, const value_type& val ) {
+			size_type	pos = static_cast<size_type>(position - begin());
+
+			_dinsertfill(pos, 1, val);
+			return begin() + pos;
+		}
+			// b) Fill
+		void	insert (iterator position, size_type n, const value_type& val) {
+			_dinsertfill(static_cast<size_type>(position - begin()), n, val);
+		}
+			// c) Range
+		template <class Iterator>
+		void insert (iterator position, Iterator first, Iterator last,
+					typename ft::enable_if<!ft::is_integral<Iterator>::value, Iterator>::type * = NULL) {
+			_dinsertrange(static_cast<size_type>(position - begin()), first, last,
+						typename iterator_traits<Iterator>::iterator_category());
+		}
+		// 3) Removing element from given position
+			// a) Single Element
+		iterator	erase(iterator position) {
+			return erase(position, position + 1);
+		}
+			// b) Range: closes the gap from the shorter side, then pops the
+			//    elements left over at that end
+		iterator	erase(iterator first, iterator last) {
+			size_type	n = static_cast<size_type>(last - first);
+			size_type	before = static_cast<size_type>(first - begin());
+
+			if (n == 0)
+				return first;
+			if (before < (size() - n) / 2) {
+				ft::copy_backward(begin(), first, last);
+				for (; n > 0; --n)
+					pop_front();
+			}
+			else {
+				ft::copy(last, end(), first);
+				for (; n > 0; --n)
+					pop_back();
+			}
+			return begin() + before;
+		}
+		// 4) Adds the last element of the container
+		void push_back (const value_type& val) {
+			if (_finish.base() + 1 != _block_end(_finish)) {
+				_alloc.construct(_finish.base(), val);
+				++_finish;
+				return ;
+			}
+			_add_block_back();
+			try {
+				_alloc.construct(_finish.base(), val);
+			}
+			catch (...) {
+				_deallocate_block(*(_finish.node() + 1));
+				throw;
+			}
+			++_finish;
+		}
+		// 5) Adds the first element of the container
+		void push_front (const value_type& val) {
+			if (_start.base() != *_start.node()) {
+				_alloc.construct(_start.base() - 1, val);
+				--_start;
+				return ;
+			}
+			_add_block_front();
+			try {
+				_alloc.construct(*(_start.node() - 1) + _block() - 1, val);
+			}
+			catch (...) {
+				_deallocate_block(*(_start.node() - 1));
+				throw;
+			}
+			--_start;
+		}
+# if __cplusplus >= 201103L
+		void push_back (value_type&& val) {
+			emplace_back(std::move(val));
+		}
+		void push_front (value_type&& val) {
+			emplace_front(std::move(val));
+		}
+			// constructs the last element in place from args
+		template <class... Args>
+		void emplace_back (Args&&... args) {
+			if (_finish.base() + 1 != _block_end(_finish)) {
+				_alloc.construct(_finish.base(), std::forward<Args>(args)...);
+				++_finish;
+				return ;
+			}
+			_add_block_back();
+			try {
+				_alloc.construct(_finish.base(), std::forward<Args>(args)...);
+			}
+			catch (...) {
+				_deallocate_block(*(_finish.node() + 1));
+				throw;
+			}
+			++_finish;
+		}
+			// constructs the first element in place from args
+		template <class... Args>
+		void emplace_front (Args&&... args) {
+			if (_start.base() != *_start.node()) {
+				_alloc.construct(_start.base() - 1, std::forward<Args>(args)...);
+				--_start;
+				return ;
+			}
+			_add_block_front();
+			try {
+				_alloc.construct(*(_start.node() - 1) + _block() - 1, std::forward<Args>(args)...);
+			}
+			catch (...) {
+				_deallocate_block(*(_start.node() - 1));
+				throw;
+			}
+			--_start;
+		}
+# endif
+		// 6) Removes the last element of the container, and its block when
+		//    it empties
+		void	pop_back() {
+			if (empty())
+				return ;
+			if (_finish.base() != *_finish.node()) {
+				--_finish;
+				_alloc.destroy(_finish.base());
+				return ;
+			}
+			pointer	block = *_finish.node();
+
+			--_finish;
+			_alloc.destroy(_finish.base());
+			_deallocate_block(block);
+		}
+		// 7) Removes the first element of the container, and its block when
+		//    it empties
+		void	pop_front() {
+			if (empty())
+				return ;
+			_alloc.destroy(_start.base());
+			if (_start.base() + 1 != _block_end(_start)) {
+				++_start;
+				return ;
+			}
+			pointer	block = *_start.node();
+
+			++_start;
+			_deallocate_block(block);
+		}
+		// 8) Resizes the container so that it contains n elements
+		void	resize(size_type n, value_type val = value_type()) {
+			if (n < size())
+				erase(begin() + n, end());
+			else
+				_dfill_back(n - size(), val);
+		}
+		// 9) Swap values of the deque with given one
+		void	swap( deque& x ) {
+			if (this != &x) {
+				ft::swap(_map, x._map);
+				ft::swap(_map_size, x._map_size);
+				ft::swap(_start, x._start);
+				ft::swap(_finish, x._finish);
+			}
+		}
+
+	// UTILS
+	private:
+		// 1) Blocks and map
+		static difference_type	_block() {
+			return deque_block_size(sizeof(value_type));
+		}
+		pointer	_block_end(const iterator& it) const {
+			return *it.node() + _block();
+		}
+		pointer	_allocate_block() {
+			return _alloc.allocate(static_cast<size_type>(_block()));
+		}
+		void	_deallocate_block(pointer block) {
+			_alloc.deallocate(block, static_cast<size_type>(_block()));
+		}
+			// a) empty deque: a small map with one block in its middle
+		void	_dinit() {
+			_map_size = 8;
+			_map = _map_alloc.allocate(_map_size);
+			try {
+				_map[_map_size / 2] = _allocate_block();
+			}
+			catch (...) {
+				_map_alloc.deallocate(_map, _map_size);
+				throw;
+			}
+			_start = iterator(_map[_map_size / 2], _map + _map_size / 2);
+			_finish = _start;
+		}
+			// b) destroys everything, blocks and map included
+		void	_ddestroy() {
+			clear();
+			_deallocate_block(*_start.node());
+			_map_alloc.deallocate(_map, _map_size);
+		}
+			// c) a new block after the last one / before the first one
+		void	_add_block_back() {
+			if (_finish.node() + 1 == _map + _map_size)
+				_reallocate_map(1, false);
+			*(_finish.node() + 1) = _allocate_block();
+		}
+		void	_add_block_front() {
+			if (_start.node() == _map)
+				_reallocate_map(1, true);
+			*(_start.node() - 1) = _allocate_block();
+		}
+			// d) makes room for n more block pointers at one end: recentres
+			//    them when the map is less than half used, else doubles it
+		void	_reallocate_map(size_type n, bool at_front) {
+			size_type	old_nodes = static_cast<size_type>(_finish.node() - _start.node()) + 1;
+			size_type	new_nodes = old_nodes + n;
+			map_pointer	new_start;
+
+			if (_map_size > 2 * new_nodes) {
+				new_start = _map + (_map_size - new_nodes) / 2 + (at_front ? n : 0);
+				if (new_start < _start.node())
+					ft::copy(_start.node(), _finish.node() + 1, new_start);
+				else
+					ft::copy_backward(_start.node(), _finish.node() + 1, new_start + old_nodes);
+			}
+			else {
+				size_type	new_size = _map_size + (_map_size > n ? _map_size : n) + 2;
+				map_pointer	new_map = _map_alloc.allocate(new_size);
+
+				new_start = new_map + (new_size - new_nodes) / 2 + (at_front ? n : 0);
+				ft::copy(_start.node(), _finish.node() + 1, new_start);
+				_map_alloc.deallocate(_map, _map_size);
+				_map = new_map;
+				_map_size = new_size;
+			}
+			_start = iterator(_start.base(), new_start);
+			_finish = iterator(_finish.base(), new_start + old_nodes - 1);
+		}
+		// 2) Appending
+		void	_dfill_back(size_type n, const value_type& val) {
+			for (; n > 0; --n)
+				push_back(val);
+		}
+		template <class InputIterator>
+		void	_dappend(InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+		// 3) Insert n copies of val before pos: grows the shorter side by n,
+		//    slides the elements between that end and pos over, then fills
+		void	_dinsertfill(size_type pos, size_type n, const value_type& val) {
+			if (n == 0)
+				return ;
+			value_type	copy(val);
+			size_type	old_size = size();
+
+			if (pos == old_size)
+				return _dfill_back(n, copy);
+			if (pos < old_size / 2) {
+				for (size_type i = 0; i < n; i++)
+					push_front(copy);
+				ft::copy(begin() + n, begin() + n + pos, begin());
+			}
+			else {
+				_dfill_back(n, copy);
+				ft::copy_backward(begin() + pos, begin() + old_size, end());
+			}
+			ft::fill(begin() + pos, begin() + pos + n, copy);
+		}
+		// 4) Insert Range
+			// for forward iterators: as the fill, copying the range in
+		template <class Iterator>
+		void	_dinsertrange(size_type pos, Iterator first, Iterator last, forward_iterator_tag) {
+			size_type	n = static_cast<size_type>(ft::distance(first, last));
+			size_type	old_size = size();
+
+			if (n == 0)
+				return ;
+			if (pos == old_size)
+				return _dappend(first, last);
+			if (pos < old_size / 2) {
+				for (size_type i = 0; i < n; i++)
+					push_front(*first);
+				ft::copy(begin() + n, begin() + n + pos, begin());
+			}
+			else {
+				_dappend(first, last);
+				ft::copy_backward(begin() + pos, begin() + old_size, end());
+			}
+			ft::copy(first, last, begin() + pos);
+		}
+			// for input_iterator_tag
+		template <class Iterator>
+		void	_dinsertrange(size_type pos, Iterator first, Iterator last, input_iterator_tag) {
+			for (; first != last; ++first, ++pos)
+				_dinsertfill(pos, 1, *first);
+		}
+		// 5) Destroys [first, last)
+		void	_destroy_range(iterator first, iterator last) {
+			_destroy_range(first, last, ft::is_trivially_destructible<value_type>());
+		}
+		void	_destroy_range(iterator, iterator, true_type) { }
+		void	_destroy_range(iterator first, iterator last, false_type) {
+			for (; first != last; ++first)
+				_alloc.destroy(first.base());
+		}
+	}; // deque
+
+	// SWAP (deques)
+	template <class T, class Alloc>
+	void	swap(deque<T,Alloc>& x, deque<T,Alloc>& y) {
+		x.swap(y);
+	}
+
+	// RELATIONAL OPERATORS (deques)
+	template <class T, class Alloc>
+	bool operator==(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+	template <class T, class Alloc>
+	bool operator<(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+	template <class T, class Alloc>
+	bool	operator>(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return rhs < lhs;
+	}
+	template <class T, class Alloc>
+	bool	operator!=(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return !(lhs == rhs);
+	}
+	template <class T, class Alloc>
+	bool	operator<=(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return !(rhs < lhs);
+	}
+	template <class T, class Alloc>
+	bool	operator>=(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs) {
+		return !(lhs < rhs);
+	}
+} // ft
+
+#endif
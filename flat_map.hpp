@@ -0,0 +1,416 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_map.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:21:05 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:21:05 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLAT_MAP_HPP
+# define FLAT_MAP_HPP
+
+# include <stdexcept>
+# include "vector.hpp"
+# include "functional.hpp"
+# include "iterators/FlatMapIterator.hpp"
+
+namespace ft {
+// Sorted associative container over two ft::vectors: the keys, and the
+// mapped values at the same indexes. Lookups binary search contiguous keys,
+// a single insertion or erasure shifts the tail (O(n)): meant for tables
+// that are built once, ideally in bulk, and read many times
+template<class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+class flat_map {
+public:
+	typedef	Key															key_type;
+	typedef	T															mapped_type;
+	typedef	Compare														key_compare;
+	typedef	typename ft::pair<const Key, T>								value_type;
+	typedef	Allocator													allocator_type;
+	typedef	typename allocator_type::size_type							size_type;
+	typedef typename allocator_type::difference_type					difference_type;
+	typedef	ft::vector<Key, typename Allocator::template rebind<Key>::other>	key_container_type;
+	typedef	ft::vector<T, typename Allocator::template rebind<T>::other>		mapped_container_type;
+	typedef	ft::FlatMapIterator<Key, T>									iterator;
+	typedef	ft::FlatMapIterator<Key, T, const T>						const_iterator;
+	typedef	typename iterator::reference								reference;
+	typedef	typename const_iterator::reference							const_reference;
+	typedef	typename iterator::pointer									pointer;
+	typedef	typename const_iterator::pointer							const_pointer;
+	typedef	ft::reverse_iterator<iterator>								reverse_iterator;
+	typedef	ft::reverse_iterator<const_iterator>						const_reverse_iterator;
+
+	class value_compare
+	{
+	private:
+		friend class flat_map;
+	protected:
+		Compare				comp;
+		value_compare	(Compare c) : comp(c) {}
+	public:
+		typedef bool		result_type;
+		typedef value_type	first_argument_type;
+		typedef value_type	second_argument_type;
+
+		bool	operator() (const value_type& x, const value_type& y) const {
+			return comp(x.first, y.first);
+		}
+	};
+
+private:
+	typedef	ft::pair<key_type, mapped_type>								_entry;
+	typedef	ft::vector<_entry>											_entries;
+
+	key_compare				_comp;
+	allocator_type			_alloc;
+	key_container_type		_keys;
+	mapped_container_type	_values;
+
+public:
+// MEMBER FUNCTIONS
+	// CONSTRUCTORS
+		// 1) Empty
+	explicit flat_map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+				: _comp(comp), _alloc(alloc), _keys(alloc), _values(alloc) { }
+		// 2) Range: one bulk insertion
+	template <class InputIterator>
+	flat_map (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _keys(alloc), _values(alloc) {
+		insert(first, last);
+	}
+		// 3) Range already sorted by comp without equivalent keys: appended as is
+	template <class InputIterator>
+	flat_map (ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _keys(alloc), _values(alloc) {
+		for (; first != last; ++first) {
+			_keys.push_back((*first).first);
+			_values.push_back((*first).second);
+		}
+	}
+		// 4) Copy
+	flat_map (const flat_map& x) : _comp(x._comp), _alloc(x._alloc), _keys(x._keys), _values(x._values) { }
+	// DESTRUCTOR
+	~flat_map () { }
+	// ASSIGN OPERATOR
+	flat_map& operator= (const flat_map& x) {
+		_comp = x._comp;
+		_keys = x._keys;
+		_values = x._values;
+		return *this;
+	}
+	// ALLOCATOR GETTER -> Returns allocator
+	allocator_type get_allocator() const { return _alloc; }
+
+// ELEMENT ACCESS
+	// AT -> access specified element with bounds checking
+	mapped_type& at (const key_type& k) {
+		size_type	i = _find(k);
+
+		if (i == size())
+			throw std::out_of_range("ft::flat_map::at");
+		return _values[i];
+	}
+	const mapped_type& at (const key_type& k) const {
+		size_type	i = _find(k);
+
+		if (i == size())
+			throw std::out_of_range("ft::flat_map::at");
+		return _values[i];
+	}
+	// [] -> access or insert specified element
+	mapped_type& operator[] (const key_type& k) {
+		return _values[_try_insert(k, nullptr).second];
+	}
+// ITERATORS
+	iterator begin() { return _it(0); }
+	const_iterator begin() const { return _it(0); }
+	iterator end() { return _it(size()); }
+	const_iterator end() const { return _it(size()); }
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+// CAPACITY
+	bool empty() const { return _keys.empty(); }
+	size_type size() const { return _keys.size(); }
+	size_type max_size() const {
+		if (_keys.max_size() < _values.max_size())
+			return _keys.max_size();
+		return _values.max_size();
+	}
+// MODIFIERS
+	// 1) Removes all elements
+	void clear() {
+		_keys.clear();
+		_values.clear();
+	}
+	// 2) Insertion of elements
+		// a) Single element
+	pair<iterator,bool> insert (const value_type& val) {
+		size_type	i = _lower(val.first);
+
+		if (i != size() && !_comp(val.first, _keys[i]))
+			return ft::make_pair(_it(i), false);
+		return ft::make_pair(_insert_at(i, val.first, val.second), true);
+	}
+		// b) With hint: no search when val belongs right before position
+	iterator insert (iterator position, const value_type& val) {
+		size_type	i = static_cast<size_type>(position - begin());
+
+		if ((i == 0 || _comp(_keys[i - 1], val.first)) && (i == size() || _comp(val.first, _keys[i])))
+			return _insert_at(i, val.first, val.second);
+		return insert(val).first;
+	}
+		// c) Range: the new elements are sorted on their own, stably so the
+		//    first of equivalent keys wins as with one insert per element,
+		//    then merged with the current ones in one pass, O(n + m log m)
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last) {
+		_entries	tmp;
+
+		for (; first != last; ++first)
+			tmp.push_back(_entry((*first).first, (*first).second));
+		if (tmp.size() > 1)
+			ft::stable_sort(tmp.begin(), tmp.end(), _entry_compare(_comp));
+		_merge(tmp);
+	}
+		// d) Range already sorted by comp without equivalent keys: merged
+		//    without sorting
+	template <class InputIterator>
+	void insert (ft::sorted_unique_t, InputIterator first, InputIterator last) {
+		_entries	tmp;
+
+		for (; first != last; ++first)
+			tmp.push_back(_entry((*first).first, (*first).second));
+		_merge(tmp);
+	}
+		// e) Inserts k only when it is missing
+	pair<iterator,bool> try_emplace (const key_type& k) {
+		pair<bool, size_type>	res = _try_insert(k, nullptr);
+
+		return ft::make_pair(_it(res.second), res.first);
+	}
+	pair<iterator,bool> try_emplace (const key_type& k, const mapped_type& obj) {
+		pair<bool, size_type>	res = _try_insert(k, &obj);
+
+		return ft::make_pair(_it(res.second), res.first);
+	}
+		// f) Assigns obj to the element with key k, inserts it when missing
+	pair<iterator,bool> insert_or_assign (const key_type& k, const mapped_type& obj) {
+		pair<bool, size_type>	res = _try_insert(k, &obj);
+
+		if (!res.first)
+			_values[res.second] = obj;
+		return ft::make_pair(_it(res.second), res.first);
+	}
+	// 3) Erase -> Removes from container elements
+		// a) Removes element in given position
+	void erase (iterator position) {
+		erase(position, position + 1);
+	}
+		// b) Removes element with given key
+	size_type erase (const key_type& k) {
+		size_type	i = _find(k);
+
+		if (i == size())
+			return 0;
+		erase(_it(i));
+		return 1;
+	}
+		// c) Removes elemets in given range
+	void erase (iterator first, iterator last) {
+		size_type	i = static_cast<size_type>(first - begin());
+		size_type	j = static_cast<size_type>(last - begin());
+
+		_keys.erase(_keys.begin() + i, _keys.begin() + j);
+		_values.erase(_values.begin() + i, _values.begin() + j);
+	}
+	// 4) Swap -> Exchanges the content of the container by the content of x
+	void swap (flat_map& x) {
+		_keys.swap(x._keys);
+		_values.swap(x._values);
+		ft::swap(_comp, x._comp);
+		ft::swap(_alloc, x._alloc);
+	}
+// LOOKUP (Operations): binary searches over the keys; with a transparent
+//    key_compare they also take any K it accepts
+	// 1) Count -> Count elements with a specific key
+	size_type count (const key_type& k) const { return _find(k) != size(); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type
+		count (const K& k) const { return _find(k) != size(); }
+	// 2) Find -> finds element with specific key
+	iterator find (const key_type& k) { return _it(_find(k)); }
+	const_iterator find (const key_type& k) const { return _it(_find(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		find (const K& k) { return _it(_find(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		find (const K& k) const { return _it(_find(k)); }
+	// 3) Get range of equal elements
+	pair<iterator,iterator> equal_range (const key_type& k) {
+		return ft::make_pair(lower_bound(k), upper_bound(k));
+	}
+	pair<const_iterator,const_iterator> equal_range (const key_type& k) const {
+		return ft::make_pair(lower_bound(k), upper_bound(k));
+	}
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<iterator,iterator> >::type
+		equal_range (const K& k) { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<const_iterator,const_iterator> >::type
+		equal_range (const K& k) const { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+	// 4) Return iterator to lower bound
+	iterator lower_bound (const key_type& k) { return _it(_lower(k)); }
+	const_iterator lower_bound (const key_type& k) const { return _it(_lower(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		lower_bound (const K& k) { return _it(_lower(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		lower_bound (const K& k) const { return _it(_lower(k)); }
+	// 5) Return iterator to upper bound
+	iterator upper_bound (const key_type& k) { return _it(_upper(k)); }
+	const_iterator upper_bound (const key_type& k) const { return _it(_upper(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		upper_bound (const K& k) { return _it(_upper(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		upper_bound (const K& k) const { return _it(_upper(k)); }
+// OBSERVERS
+	key_compare key_comp() const { return _comp; }
+	value_compare value_comp() const { return value_compare(_comp); }
+	// The underlying sorted arrays
+	const key_container_type& keys() const { return _keys; }
+	const mapped_container_type& values() const { return _values; }
+private:
+	// Iterator to the element at index i
+	iterator _it (size_type i) { return iterator(_keys.data() + i, _values.data() + i); }
+	const_iterator _it (size_type i) const { return const_iterator(_keys.data() + i, _values.data() + i); }
+	// Index of the first key not less / greater than k, of k or size()
+	template <class K>
+	size_type _lower (const K& k) const {
+		return static_cast<size_type>(ft::lower_bound(_keys.begin(), _keys.end(), k, _comp) - _keys.begin());
+	}
+	template <class K>
+	size_type _upper (const K& k) const {
+		return static_cast<size_type>(ft::upper_bound(_keys.begin(), _keys.end(), k, _comp) - _keys.begin());
+	}
+	template <class K>
+	size_type _find (const K& k) const {
+		size_type	i = _lower(k);
+
+		if (i != size() && !_comp(k, _keys[i]))
+			return i;
+		return size();
+	}
+	// Puts (k, obj) at index i, both arrays or neither
+	iterator _insert_at (size_type i, const key_type& k, const mapped_type& obj) {
+		_keys.insert(_keys.begin() + i, k);
+		try {
+			_values.insert(_values.begin() + i, obj);
+		}
+		catch (...) {
+			_keys.erase(_keys.begin() + i);
+			throw;
+		}
+		return _it(i);
+	}
+	// Inserts (k, *obj), or (k, mapped_type()) when obj is null, if k is
+	// missing; returns whether it did and the index of k
+	pair<bool, size_type> _try_insert (const key_type& k, const mapped_type* obj) {
+		size_type	i = _lower(k);
+
+		if (i != size() && !_comp(k, _keys[i]))
+			return ft::make_pair(false, i);
+		if (obj != nullptr)
+			_insert_at(i, k, *obj);
+		else
+			_insert_at(i, k, mapped_type());
+		return ft::make_pair(true, i);
+	}
+	// Merges sorted entries into new arrays, skipping keys that are already
+	// present or repeated; the current arrays are only replaced at the end
+	void _merge (const _entries& tmp) {
+		if (tmp.empty())
+			return ;
+		if (tmp.size() == 1) {
+			try_emplace(tmp[0].first, tmp[0].second);
+			return ;
+		}
+		key_container_type		keys(_keys.get_allocator());
+		mapped_container_type	values(_values.get_allocator());
+		size_type				i = 0;
+
+		keys.reserve(size() + tmp.size());
+		values.reserve(size() + tmp.size());
+		for (size_type j = 0; j < tmp.size(); j++) {
+			const key_type&	k = tmp[j].first;
+
+			if (j != 0 && !_comp(tmp[j - 1].first, k))
+				continue ;
+			for (; i < size() && _comp(_keys[i], k); i++) {
+				keys.push_back(_keys[i]);
+				values.push_back(_values[i]);
+			}
+			if (i < size() && !_comp(k, _keys[i]))
+				continue ;
+			keys.push_back(k);
+			values.push_back(tmp[j].second);
+		}
+		for (; i < size(); i++) {
+			keys.push_back(_keys[i]);
+			values.push_back(_values[i]);
+		}
+		_keys.swap(keys);
+		_values.swap(values);
+	}
+	// Orders entries on their key
+	struct _entry_compare {
+		key_compare	comp;
+
+		_entry_compare(const key_compare& c) : comp(c) { }
+		bool	operator() (const _entry& x, const _entry& y) const { return comp(x.first, y.first); }
+	};
+};
+
+// RELATIONAL OPERATORS FLAT MAP
+template< class Key, class T, class Compare, class Alloc >
+bool operator==( const ft::flat_map<Key,T,Compare,Alloc>& lhs, const ft::flat_map<Key,T,Compare,Alloc>& rhs ) {
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator!= ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ) {
+	return !(lhs == rhs);
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator< ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ) {
+	return ft::lexicographical_compare (lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator<= ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ) {
+	return 	!(rhs < lhs);
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator>  ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ) {
+	return rhs < lhs;
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator>= ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ) {
+	return 	!(lhs < rhs);
+}
+//SWAP
+template <class Key, class T, class Compare, class Alloc>
+void swap (flat_map<Key,T,Compare,Alloc>& lhs, flat_map<Key,T,Compare,Alloc>& rhs) { lhs.swap(rhs); }
+
+}
+
+#endif
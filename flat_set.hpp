@@ -0,0 +1,258 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_set.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:21:42 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:39:55 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLAT_SET_HPP
+# define FLAT_SET_HPP
+
+# include "vector.hpp"
+# include "functional.hpp"
+# include "utility.hpp"
+
+namespace ft {
+// Sorted associative container over one ft::vector of keys, the set
+// counterpart of flat_map: binary search lookups, O(n) single insertion
+// and erasure, bulk insertion by sort and merge
+template< class Key, class Compare = std::less<Key>, class Allocator = std::allocator<Key> >
+class flat_set {
+public:
+	typedef	Key															key_type;
+	typedef	Key															value_type;
+	typedef	Compare														key_compare;
+	typedef	Compare														value_compare;
+	typedef	Allocator													allocator_type;
+	typedef	typename allocator_type::reference							reference;
+	typedef	typename allocator_type::const_reference					const_reference;
+	typedef	typename allocator_type::pointer							pointer;
+	typedef	typename allocator_type::const_pointer						const_pointer;
+	typedef typename allocator_type::difference_type					difference_type;
+	typedef	typename allocator_type::size_type							size_type;
+	typedef	ft::vector<Key, Allocator>									container_type;
+	typedef	typename container_type::const_iterator						iterator;
+	typedef	typename container_type::const_iterator						const_iterator;
+	typedef	typename container_type::const_reverse_iterator				reverse_iterator;
+	typedef	typename container_type::const_reverse_iterator				const_reverse_iterator;
+
+private:
+	key_compare				_comp;
+	container_type			_keys;
+
+public:
+// MEMBER FUNCTIONS
+	// CONSTRUCTORS
+		// 1) Empty
+	explicit flat_set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+				: _comp(comp), _keys(alloc) { }
+		// 2) Range: one bulk insertion
+	template <class InputIterator>
+	flat_set (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _keys(alloc) {
+		insert(first, last);
+	}
+		// 3) Range already sorted by comp without equivalent keys: copied as is
+	template <class InputIterator>
+	flat_set (ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _keys(first, last, alloc) { }
+		// 4) Copy
+	flat_set (const flat_set& x) : _comp(x._comp), _keys(x._keys) { }
+	// DESTRUCTOR
+	~flat_set () { }
+	// ASSIGN OPERATOR
+	flat_set& operator= (const flat_set& x) {
+		_comp = x._comp;
+		_keys = x._keys;
+		return *this;
+	}
+	// ALLOCATOR GETTER -> Returns allocator
+	allocator_type get_allocator() const { return _keys.get_allocator(); }
+
+// ITERATORS
+	iterator begin() const { return _keys.begin(); }
+	iterator end() const { return _keys.end(); }
+	reverse_iterator rbegin() const { return _keys.rbegin(); }
+	reverse_iterator rend() const { return _keys.rend(); }
+// CAPACITY
+	bool empty() const { return _keys.empty(); }
+	size_type size() const { return _keys.size(); }
+	size_type max_size() const { return _keys.max_size(); }
+// MODIFIERS
+	// 1) Removes all elements
+	void clear() { _keys.clear(); }
+	// 2) Insertion of elements
+		// a) Single element
+	pair<iterator,bool> insert (const value_type& val) {
+		size_type	i = _lower(val);
+
+		if (i != size() && !_comp(val, _keys[i]))
+			return ft::make_pair(begin() + i, false);
+		_keys.insert(_keys.begin() + i, val);
+		return ft::make_pair(begin() + i, true);
+	}
+		// b) With hint: no search when val belongs right before position
+	iterator insert (iterator position, const value_type& val) {
+		size_type	i = static_cast<size_type>(position - begin());
+
+		if ((i == 0 || _comp(_keys[i - 1], val)) && (i == size() || _comp(val, _keys[i]))) {
+			_keys.insert(_keys.begin() + i, val);
+			return begin() + i;
+		}
+		return insert(val).first;
+	}
+		// c) Range: the new keys are sorted on their own, stably so the
+		//    first of equivalent keys wins, then merged in one pass
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last) {
+		container_type	tmp(first, last, _keys.get_allocator());
+
+		if (tmp.size() > 1)
+			ft::stable_sort(tmp.begin(), tmp.end(), _comp);
+		_merge(tmp);
+	}
+		// d) Range already sorted by comp without equivalent keys
+	template <class InputIterator>
+	void insert (ft::sorted_unique_t, InputIterator first, InputIterator last) {
+		container_type	tmp(first, last, _keys.get_allocator());
+
+		_merge(tmp);
+	}
+	// 3) Erase -> Removes from container elements
+		// a) Removes element in given position
+	void erase (iterator position) { erase(position, position + 1); }
+		// b) Removes element with given key
+	size_type erase (const key_type& k) {
+		size_type	i = _find(k);
+
+		if (i == size())
+			return 0;
+		_keys.erase(_keys.begin() + i);
+		return 1;
+	}
+		// c) Removes elemets in given range
+	void erase (iterator first, iterator last) {
+		_keys.erase(_keys.begin() + (first - begin()), _keys.begin() + (last - begin()));
+	}
+	// 4) Swap -> Exchanges the content of the container by the content of x
+	void swap (flat_set& x) {
+		_keys.swap(x._keys);
+		ft::swap(_comp, x._comp);
+	}
+// LOOKUP (Operations): binary searches; with a transparent key_compare
+//    they also take any K it accepts
+	// 1) Count -> Count elements with a specific key
+	size_type count (const key_type& k) const { return _find(k) != size(); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type
+		count (const K& k) const { return _find(k) != size(); }
+	// 2) Find -> finds element with specific key
+	iterator find (const key_type& k) const { return begin() + _find(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		find (const K& k) const { return begin() + _find(k); }
+	// 3) Get range of equal elements
+	pair<iterator,iterator> equal_range (const key_type& k) const {
+		return ft::make_pair(lower_bound(k), upper_bound(k));
+	}
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<iterator,iterator> >::type
+		equal_range (const K& k) const { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+	// 4) Return iterator to lower bound
+	iterator lower_bound (const key_type& k) const { return begin() + _lower(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		lower_bound (const K& k) const { return begin() + _lower(k); }
+	// 5) Return iterator to upper bound
+	iterator upper_bound (const key_type& k) const { return begin() + _upper(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		upper_bound (const K& k) const { return begin() + _upper(k); }
+// OBSERVERS
+	key_compare key_comp() const { return _comp; }
+	value_compare value_comp() const { return _comp; }
+	// The underlying sorted array
+	const container_type& keys() const { return _keys; }
+private:
+	// Index of the first key not less / greater than k, of k or size()
+	template <class K>
+	size_type _lower (const K& k) const {
+		return static_cast<size_type>(ft::lower_bound(_keys.begin(), _keys.end(), k, _comp) - _keys.begin());
+	}
+	template <class K>
+	size_type _upper (const K& k) const {
+		return static_cast<size_type>(ft::upper_bound(_keys.begin(), _keys.end(), k, _comp) - _keys.begin());
+	}
+	template <class K>
+	size_type _find (const K& k) const {
+		size_type	i = _lower(k);
+
+		if (i != size() && !_comp(k, _keys[i]))
+			return i;
+		return size();
+	}
+	// Merges sorted keys into a new array, skipping keys that are already
+	// present or repeated; the current array is only replaced at the end
+	void _merge (const container_type& tmp) {
+		if (tmp.empty())
+			return ;
+		if (tmp.size() == 1) {
+			insert(tmp[0]);
+			return ;
+		}
+		container_type	keys(_keys.get_allocator());
+		size_type		i = 0;
+
+		keys.reserve(size() + tmp.size());
+		for (size_type j = 0; j < tmp.size(); j++) {
+			if (j != 0 && !_comp(tmp[j - 1], tmp[j]))
+				continue ;
+			for (; i < size() && _comp(_keys[i], tmp[j]); i++)
+				keys.push_back(_keys[i]);
+			if (i < size() && !_comp(tmp[j], _keys[i]))
+				continue ;
+			keys.push_back(tmp[j]);
+		}
+		for (; i < size(); i++)
+			keys.push_back(_keys[i]);
+		_keys.swap(keys);
+	}
+};
+
+// RELATIONAL OPERATORS FLAT SET
+template< class Key, class Compare, class Alloc >
+bool operator==( const ft::flat_set<Key,Compare,Alloc>& lhs, const ft::flat_set<Key,Compare,Alloc>& rhs ) {
+	return lhs.keys() == rhs.keys();
+}
+template< class Key, class Compare, class Alloc >
+bool operator!=( const ft::flat_set<Key,Compare,Alloc>& lhs, const ft::flat_set<Key,Compare,Alloc>& rhs ) {
+	return !(lhs == rhs);
+}
+template< class Key, class Compare, class Alloc >
+bool operator<( const ft::flat_set<Key,Compare,Alloc>& lhs, const ft::flat_set<Key,Compare,Alloc>& rhs ) {
+	return lhs.keys() < rhs.keys();
+}
+template< class Key, class Compare, class Alloc >
+bool operator<=( const ft::flat_set<Key,Compare,Alloc>& lhs, const ft::flat_set<Key,Compare,Alloc>& rhs ) {
+	return !(rhs < lhs);
+}
+template< class Key, class Compare, class Alloc >
+bool operator>( const ft::flat_set<Key,Compare,Alloc>& lhs, const ft::flat_set<Key,Compare,Alloc>& rhs ) {
+	return rhs < lhs;
+}
+template< class Key, class Compare, class Alloc >
+bool operator>=( const ft::flat_set<Key,Compare,Alloc>& lhs, const ft::flat_set<Key,Compare,Alloc>& rhs ) {
+	return !(lhs < rhs);
+}
+//SWAP
+template <class Key, class Compare, class Alloc>
+void swap (flat_set<Key,Compare,Alloc>& lhs, flat_set<Key,Compare,Alloc>& rhs) { lhs.swap(rhs); }
+
+}
+
+#endif
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   functional.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:47:41 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:36:45 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FUNCTIONAL_HPP
+# define FUNCTIONAL_HPP
+
+# include <cstddef>
+# include <string>
+
+namespace ft {
+	////COMPARISON
+	template <class T = void>
+	struct less {
+		typedef T		first_argument_type;
+		typedef T		second_argument_type;
+		typedef bool	result_type;
+
+		bool operator()( const T& x, const T& y ) const { return x < y; }
+	};
+
+	// Transparent: compares any two types with an operator<, so map and set
+	// can look a key up without converting it to key_type first
+	template <>
+	struct less<void> {
+		typedef void	is_transparent;
+
+		template <class T, class U>
+		bool operator()( const T& x, const U& y ) const { return x < y; }
+	};
+
+	////KEY EXTRACTORS
+		// give ft::tree the key a stored value is ordered on
+	template <class T>
+	struct identity {
+		const T& operator()( const T& x ) const { return x; }
+	};
+
+	template <class Pair>
+	struct select_first {
+		const typename Pair::first_type& operator()( const Pair& x ) const { return x.first; }
+	};
+
+	////HASHING
+		// ft::unordered_map and ft::unordered_set hash keys with these. The
+		// integral ones return the value itself: the table multiplies every
+		// hash by a golden-ratio constant before taking its top bits, which
+		// spreads sequential keys well enough
+	template <class T>
+	struct hash;
+
+# define FT_HASH_INTEGRAL(T) \
+	template <> \
+	struct hash<T> { \
+		typedef T			argument_type; \
+		typedef std::size_t	result_type; \
+		std::size_t operator()( T x ) const { return static_cast<std::size_t>(x); } \
+	};
+	FT_HASH_INTEGRAL(bool)
+	FT_HASH_INTEGRAL(char)
+	FT_HASH_INTEGRAL(signed char)
+	FT_HASH_INTEGRAL(unsigned char)
+	FT_HASH_INTEGRAL(wchar_t)
+	FT_HASH_INTEGRAL(short)
+	FT_HASH_INTEGRAL(unsigned short)
+	FT_HASH_INTEGRAL(int)
+	FT_HASH_INTEGRAL(unsigned int)
+	FT_HASH_INTEGRAL(long)
+	FT_HASH_INTEGRAL(unsigned long)
+# if __cplusplus >= 201103L
+	FT_HASH_INTEGRAL(long long)
+	FT_HASH_INTEGRAL(unsigned long long)
+# endif
+# undef FT_HASH_INTEGRAL
+
+	template <class T>
+	struct hash<T*> {
+		typedef T*			argument_type;
+		typedef std::size_t	result_type;
+		std::size_t operator()( T* x ) const { return reinterpret_cast<std::size_t>(x); }
+	};
+
+		// FNV-1a over the characters
+	template <class C, class Traits, class Alloc>
+	struct hash<std::basic_string<C, Traits, Alloc> > {
+		typedef std::basic_string<C, Traits, Alloc>	argument_type;
+		typedef std::size_t							result_type;
+		std::size_t operator()( const argument_type& x ) const {
+			std::size_t	h = 2166136261UL;
+
+			for (typename argument_type::size_type i = 0; i < x.size(); i++)
+				h = (h ^ static_cast<std::size_t>(x[i])) * 16777619UL;
+			return h;
+		}
+	};
+
+	////EQUALITY
+	template <class T>
+	struct equal_to {
+		typedef T		first_argument_type;
+		typedef T		second_argument_type;
+		typedef bool	result_type;
+
+		bool operator()( const T& x, const T& y ) const { return x == y; }
+	};
+}
+
+#endif
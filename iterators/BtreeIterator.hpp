@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   BtreeIterator.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:25:50 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:31:45 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREEITERATOR_HPP
+# define BTREEITERATOR_HPP
+
+# include <cstddef>
+# include "iterator.hpp"
+
+namespace ft {
+	//B-TREE NODES
+		// Values per node: as many as fit in NodeBytes next to the header,
+		// at least 3 and at most 255 (positions are stored in a byte)
+	template <class T, std::size_t NodeBytes>
+	struct BtreeSlots {
+		enum {
+			header = sizeof(void*) + 3,
+			fit = (NodeBytes > header + 3 * sizeof(T)) ? (NodeBytes - header) / sizeof(T) : 3,
+			value = fit > 255 ? 255 : fit
+		};
+	};
+		// A leaf keeps up to Slots values in raw storage, constructed in
+		// [0, count); an internal node (BtreeInternal) adds count + 1 children
+	template <class T, int Slots>
+	struct BtreeNode {
+		BtreeNode*		parent;		// null for the root
+		unsigned char	position;	// index in parent's children
+		unsigned char	count;
+		bool			leaf;
+		union {
+			char		bytes[sizeof(T) * Slots];
+			long double	align_ld;
+			long long	align_ll;
+			void*		align_p;
+		}				slots;
+
+		T*			values() { return reinterpret_cast<T*>(slots.bytes); }
+		T&			value(int i) { return values()[i]; }
+		BtreeNode*&	child(int i);
+	};
+	template <class T, int Slots>
+	struct BtreeInternal : public BtreeNode<T, Slots> {
+		BtreeNode<T, Slots>*	children[Slots + 1];
+	};
+	template <class T, int Slots>
+	BtreeNode<T, Slots>*&	BtreeNode<T, Slots>::child(int i) {
+		return static_cast<BtreeInternal<T, Slots>*>(this)->children[i];
+	}
+
+	//B-TREE ITERATORS
+		// a node and a value index in it; end() is one past the last value
+		// of the rightmost leaf. Node is the non-const node type
+	template <class T, class Node>
+	class BtreeIterator {
+	public:
+		typedef T															value_type;
+		typedef T*															pointer;
+		typedef T&															reference;
+		typedef std::ptrdiff_t												difference_type;
+		typedef typename ft::bidirectional_iterator_tag						iterator_category;
+
+	// CONSTRUCTORS
+		// 1) Default
+		BtreeIterator() : _node(), _pos() { }
+		// 2) Initialization
+		BtreeIterator(Node* node, int pos) : _node(node), _pos(pos) { }
+	// MEMBER FUNCTIONS
+		// Base - returns the node and the index in it
+		Node*	node() const { return _node; }
+		int		position() const { return _pos; }
+		// Dereference iterator
+		reference	operator*() const { return _node->value(_pos); }
+		pointer		operator->() const { return &_node->value(_pos); }
+		// Pre-increment iterator position: the next value of a leaf, else
+		// the leftmost value right of this one, else the first ancestor
+		// value on the right; past the last value it stays at end()
+		BtreeIterator&	operator++() {
+			if (!_node->leaf) {
+				_node = _node->child(_pos + 1);
+				while (!_node->leaf)
+					_node = _node->child(0);
+				_pos = 0;
+				return *this;
+			}
+			if (++_pos < _node->count)
+				return *this;
+			Node*	node = _node;
+			int		pos = _pos;
+
+			while (pos == node->count && node->parent != nullptr) {
+				pos = node->position;
+				node = node->parent;
+			}
+			if (pos < node->count) {
+				_node = node;
+				_pos = pos;
+			}
+			return *this;
+		}
+		// Post-increment iterator position
+		BtreeIterator	operator++(int) {
+			BtreeIterator	tmp = *this;
+
+			++(*this);
+			return tmp;
+		}
+		// Pre-decrement iterator position, the mirror image
+		BtreeIterator&	operator--() {
+			if (!_node->leaf) {
+				_node = _node->child(_pos);
+				while (!_node->leaf)
+					_node = _node->child(_node->count);
+				_pos = _node->count - 1;
+				return *this;
+			}
+			if (--_pos >= 0)
+				return *this;
+			while (_pos < 0 && _node->parent != nullptr) {
+				_pos = _node->position - 1;
+				_node = _node->parent;
+			}
+			return *this;
+		}
+		// Post-decrement iterator position
+		BtreeIterator	operator--(int) {
+			BtreeIterator	tmp = *this;
+
+			--(*this);
+			return tmp;
+		}
+		// Constant cast overload
+		operator BtreeIterator<const T, Node>() const {
+			return BtreeIterator<const T, Node>(_node, _pos);
+		}
+	private:
+		Node*	_node;
+		int		_pos;
+	};
+
+	//RELATIONAL OPERATORS
+	template <class T1, class T2, class Node>
+	bool operator==(const BtreeIterator<T1, Node>& lhs, const BtreeIterator<T2, Node>& rhs) {
+		return lhs.node() == rhs.node() && lhs.position() == rhs.position();
+	}
+	template <class T1, class T2, class Node>
+	bool operator!=(const BtreeIterator<T1, Node>& lhs, const BtreeIterator<T2, Node>& rhs) {
+		return !(lhs == rhs);
+	}
+}
+
+#endif
@@ -0,0 +1,209 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   DequeIterator.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:15:12 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:25:47 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef DEQUEITERATOR_HPP
+# define DEQUEITERATOR_HPP
+
+# include "iterator.hpp"
+# include "../type_traits.hpp"
+
+# define DEQUE_BLOCK_BYTES 4096
+
+namespace ft{
+	// Elements per deque block: DEQUE_BLOCK_BYTES worth of them, but at least
+	// 16 so a deque of big objects does not allocate for every element
+	inline std::ptrdiff_t	deque_block_size(std::size_t size) {
+		return static_cast<std::ptrdiff_t>(size < DEQUE_BLOCK_BYTES / 16 ? DEQUE_BLOCK_BYTES / size : 16);
+	}
+
+	//DEQUE ITERATORS
+		// _cur walks the block [_first, _last); _node is its slot in the
+		// deque's map of blocks, used to step into the next or previous one
+	template <class T>
+	class DequeIterator {
+	public:
+		typedef T*															iterator_type;
+		typedef typename iterator_traits<iterator_type>::value_type			value_type;
+		typedef typename iterator_traits<iterator_type>::difference_type	difference_type;
+		typedef typename iterator_traits<iterator_type>::pointer			pointer;
+		typedef typename iterator_traits<iterator_type>::reference			reference;
+		typedef typename iterator_traits<iterator_type>::iterator_category	iterator_category;
+		typedef typename ft::remove_const<T>::type*							block_pointer;
+		typedef block_pointer*												map_pointer;
+
+	// CONSTRUCTORS
+		// 1) Default
+		DequeIterator() : _cur(), _first(), _last(), _node() { }
+		// 2) Initialization: cur inside the block at node
+		DequeIterator(pointer cur, map_pointer node)
+			: _cur(cur), _first(*node), _last(*node + deque_block_size(sizeof(T))), _node(node) { }
+		// 3) Copy
+		DequeIterator ( const DequeIterator& x )
+			: _cur(x._cur), _first(x._first), _last(x._last), _node(x._node) { }
+	// ASSIGN OPERATOR
+		DequeIterator& operator=( const DequeIterator& x ) {
+			_cur = x._cur;
+			_first = x._first;
+			_last = x._last;
+			_node = x._node;
+			return	*this;
+		}
+	// DESTRUCTOR
+		~DequeIterator() { }
+	// MEMBER FUNCTIONS
+		// Base - returns the element pointer
+		pointer	base() const {
+			return _cur;
+		}
+		map_pointer	node() const {
+			return _node;
+		}
+		// Pre-increment iterator position
+		DequeIterator&	operator++() {
+			if (++_cur == _last) {
+				_set_node(_node + 1);
+				_cur = _first;
+			}
+			return *this;
+		}
+		// Post-increment iterator position
+		DequeIterator	operator++(int) {
+			DequeIterator temp = *this;
+			++*this;
+			return temp;
+		}
+		// Dereference iterator
+		reference	operator*() const {
+			return *_cur;
+		}
+		// Dereference iterator
+		pointer operator->() const {
+			return _cur;
+		}
+		// Pre-decrement iterator position
+		DequeIterator&	operator--() {
+			if (_cur == _first) {
+				_set_node(_node - 1);
+				_cur = _last;
+			}
+			--_cur;
+			return *this;
+		}
+		// Post-decrement iterator position
+		DequeIterator	operator--(int) {
+			DequeIterator temp = *this;
+			--*this;
+			return temp;
+		}
+		// Advance iterator: stays in the block when it can, else jumps
+		// straight to the right one
+		DequeIterator&	operator+= (difference_type n) {
+			difference_type	block = deque_block_size(sizeof(T));
+			difference_type	offset = n + (_cur - _first);
+
+			if (offset >= 0 && offset < block)
+				_cur += n;
+			else {
+				difference_type	nodes = offset > 0 ? offset / block : -((-offset - 1) / block) - 1;
+
+				_set_node(_node + nodes);
+				_cur = _first + (offset - nodes * block);
+			}
+			return *this;
+		}
+		// Addition operator
+		DequeIterator	operator+ (difference_type n) const {
+			DequeIterator	temp = *this;
+
+			return temp += n;
+		}
+		// Retrocede iterator
+		DequeIterator&	operator-= (difference_type n) {
+			return *this += -n;
+		}
+		// Subtraction operator
+		DequeIterator	operator- (difference_type n) const {
+			DequeIterator	temp = *this;
+
+			return temp += -n;
+		}
+		// Dereference iterator with offset
+		reference	operator[] (difference_type n) const {
+			return *(*this + n);
+		}
+		// Constant cast overload
+		operator DequeIterator<const T>() const {
+			if (_node == nullptr)
+				return DequeIterator<const T>();
+			return DequeIterator<const T>(_cur, _node);
+		}
+	private:
+		void	_set_node(map_pointer node) {
+			_node = node;
+			_first = *node;
+			_last = _first + deque_block_size(sizeof(T));
+		}
+
+		pointer		_cur;
+		pointer		_first;
+		pointer		_last;
+		map_pointer	_node;
+	};
+
+	//RELATIONAL OPERATORS
+	template <class T, class T1>
+	bool operator==(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return lhs.base() == rhs.base();
+	}
+	template <class T, class T1>
+	bool operator!=(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return lhs.base() != rhs.base();
+	}
+	template <class T, class T1>
+	bool operator<(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		if (lhs.node() == rhs.node())
+			return lhs.base() < rhs.base();
+		return lhs.node() < rhs.node();
+	}
+	template <class T, class T1>
+	bool operator>(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return rhs < lhs;
+	}
+	template <class T, class T1>
+	bool operator<=(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return !(rhs < lhs);
+	}
+	template <class T, class T1>
+	bool operator>=(const DequeIterator<T>& lhs, const DequeIterator<T1>& rhs) {
+		return !(lhs < rhs);
+	}
+	// COMPUTES THE DISTANCE BETWEEN TWO ITERATOR ADAPTORS
+		// whole blocks between them, plus the parts of their own blocks
+	template<class T1, class T2>
+	typename DequeIterator<T1>::difference_type
+		operator-(	const DequeIterator<T1>& lhs, const DequeIterator<T2>& rhs ) {
+			if (lhs.node() == rhs.node())
+				return lhs.base() - rhs.base();
+			typename DequeIterator<T1>::difference_type	block = deque_block_size(sizeof(T1));
+
+			return block * (lhs.node() - rhs.node() - 1)
+				+ (lhs.base() - *lhs.node()) + (*rhs.node() + block - rhs.base());
+	}
+	// ADVANCES THE ITERATOR
+	template<class T>
+	DequeIterator<T>	operator+( typename DequeIterator<T>::difference_type n,
+										const DequeIterator<T>& it ) {
+			return it + n;
+	}
+}
+
+#endif
@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FlatMapIterator.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:19:50 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:19:50 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLATMAPITERATOR_HPP
+# define FLATMAPITERATOR_HPP
+
+# include "iterator.hpp"
+# include "../utility.hpp"
+
+namespace ft {
+	// What a flat_map iterator yields: its key and mapped value live in two
+	// separate arrays, so there is no pair in memory to point at
+	template <class Key, class V>
+	struct FlatMapReference {
+		const Key&	first;
+		V&			second;
+
+		FlatMapReference(const Key& k, V& v) : first(k), second(v) { }
+		template <class U>
+		operator ft::pair<const Key, U>() const { return ft::pair<const Key, U>(first, second); }
+	};
+
+	template <class Key, class V1, class V2>
+	bool operator==(const FlatMapReference<Key, V1>& lhs, const FlatMapReference<Key, V2>& rhs) {
+		return lhs.first == rhs.first && lhs.second == rhs.second;
+	}
+	template <class Key, class V1, class V2>
+	bool operator<(const FlatMapReference<Key, V1>& lhs, const FlatMapReference<Key, V2>& rhs) {
+		return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+	}
+
+	//FLAT MAP ITERATORS
+		// a key pointer and a mapped value pointer moved in step;
+		// V is the mapped type T, const T for const_iterator
+	template <class Key, class T, class V = T>
+	class FlatMapIterator {
+	public:
+		typedef FlatMapReference<Key, V>									reference;
+		typedef ft::pair<const Key, T>										value_type;
+		typedef std::ptrdiff_t												difference_type;
+		typedef typename ft::random_access_iterator_tag						iterator_category;
+		// it->first works through a proxy holding the reference
+		struct pointer {
+			reference	ref;
+
+			pointer(const reference& r) : ref(r) { }
+			const reference*	operator->() const { return &ref; }
+		};
+
+	// CONSTRUCTORS
+		// 1) Default
+		FlatMapIterator() : _key(), _val() { }
+		// 2) Initialization
+		FlatMapIterator(const Key* key, V* val) : _key(key), _val(val) { }
+	// MEMBER FUNCTIONS
+		// Base - returns the key and mapped value pointers
+		const Key*	key_base() const { return _key; }
+		V*			value_base() const { return _val; }
+		// Dereference iterator
+		reference	operator*() const { return reference(*_key, *_val); }
+		pointer		operator->() const { return pointer(**this); }
+		reference	operator[] (difference_type n) const { return reference(_key[n], _val[n]); }
+		// Increment / decrement iterator position
+		FlatMapIterator&	operator++() { ++_key; ++_val; return *this; }
+		FlatMapIterator		operator++(int) { FlatMapIterator tmp = *this; ++*this; return tmp; }
+		FlatMapIterator&	operator--() { --_key; --_val; return *this; }
+		FlatMapIterator		operator--(int) { FlatMapIterator tmp = *this; --*this; return tmp; }
+		// Advance / retrocede iterator
+		FlatMapIterator&	operator+= (difference_type n) { _key += n; _val += n; return *this; }
+		FlatMapIterator&	operator-= (difference_type n) { _key -= n; _val -= n; return *this; }
+		FlatMapIterator		operator+ (difference_type n) const { return FlatMapIterator(_key + n, _val + n); }
+		FlatMapIterator		operator- (difference_type n) const { return FlatMapIterator(_key - n, _val - n); }
+		// Constant cast overload
+		operator FlatMapIterator<Key, T, const T>() const {
+			return FlatMapIterator<Key, T, const T>(_key, _val);
+		}
+	private:
+		const Key*	_key;
+		V*			_val;
+	};
+
+	//RELATIONAL OPERATORS: the key pointer alone tells the position
+	template <class Key, class T, class V1, class V2>
+	bool operator==(const FlatMapIterator<Key, T, V1>& lhs, const FlatMapIterator<Key, T, V2>& rhs) {
+		return lhs.key_base() == rhs.key_base();
+	}
+	template <class Key, class T, class V1, class V2>
+	bool operator!=(const FlatMapIterator<Key, T, V1>& lhs, const FlatMapIterator<Key, T, V2>& rhs) {
+		return lhs.key_base() != rhs.key_base();
+	}
+	template <class Key, class T, class V1, class V2>
+	bool operator<(const FlatMapIterator<Key, T, V1>& lhs, const FlatMapIterator<Key, T, V2>& rhs) {
+		return lhs.key_base() < rhs.key_base();
+	}
+	template <class Key, class T, class V1, class V2>
+	bool operator>(const FlatMapIterator<Key, T, V1>& lhs, const FlatMapIterator<Key, T, V2>& rhs) {
+		return lhs.key_base() > rhs.key_base();
+	}
+	template <class Key, class T, class V1, class V2>
+	bool operator<=(const FlatMapIterator<Key, T, V1>& lhs, const FlatMapIterator<Key, T, V2>& rhs) {
+		return lhs.key_base() <= rhs.key_base();
+	}
+	template <class Key, class T, class V1, class V2>
+	bool operator>=(const FlatMapIterator<Key, T, V1>& lhs, const FlatMapIterator<Key, T, V2>& rhs) {
+		return lhs.key_base() >= rhs.key_base();
+	}
+	// COMPUTES THE DISTANCE BETWEEN TWO ITERATORS
+	template <class Key, class T, class V1, class V2>
+	std::ptrdiff_t	operator-(const FlatMapIterator<Key, T, V1>& lhs, const FlatMapIterator<Key, T, V2>& rhs) {
+		return lhs.key_base() - rhs.key_base();
+	}
+	// ADVANCES THE ITERATOR
+	template <class Key, class T, class V>
+	FlatMapIterator<Key, T, V>	operator+(std::ptrdiff_t n, const FlatMapIterator<Key, T, V>& it) {
+		return it + n;
+	}
+}
+
+#endif
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   HashIterator.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:32:31 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:36:45 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASHITERATOR_HPP
+# define HASHITERATOR_HPP
+
+# include <cstddef>
+# include "iterator.hpp"
+
+namespace ft {
+	//HASH TABLE ITERATORS
+		// a slot and its probe distance byte (0 for an empty slot). The
+		// table keeps a non-zero byte one past its last slot, so skipping
+		// empty slots needs no bounds check and stops at end()
+	template <class T>
+	class HashIterator {
+	public:
+		typedef T															value_type;
+		typedef T*															pointer;
+		typedef T&															reference;
+		typedef std::ptrdiff_t												difference_type;
+		typedef typename ft::forward_iterator_tag							iterator_category;
+
+	// CONSTRUCTORS
+		// 1) Default
+		HashIterator() : _dist(), _slot() { }
+		// 2) Initialization
+		HashIterator(const unsigned char* dist, T* slot) : _dist(dist), _slot(slot) { }
+	// MEMBER FUNCTIONS
+		// Base - returns the slot and its probe distance byte
+		T*						base() const { return _slot; }
+		const unsigned char*	dist() const { return _dist; }
+		// Dereference iterator
+		reference	operator*() const { return *_slot; }
+		pointer		operator->() const { return _slot; }
+		// Pre-increment iterator position: next occupied slot
+		HashIterator&	operator++() {
+			do {
+				++_dist;
+				++_slot;
+			} while (*_dist == 0);
+			return *this;
+		}
+		// Post-increment iterator position
+		HashIterator	operator++(int) {
+			HashIterator	tmp = *this;
+
+			++(*this);
+			return tmp;
+		}
+		// Constant cast overload
+		operator HashIterator<const T>() const {
+			return HashIterator<const T>(_dist, _slot);
+		}
+	private:
+		const unsigned char*	_dist;
+		T*						_slot;
+	};
+
+	//RELATIONAL OPERATORS
+	template <class T1, class T2>
+	bool operator==(const HashIterator<T1>& lhs, const HashIterator<T2>& rhs) {
+		return lhs.dist() == rhs.dist();
+	}
+	template <class T1, class T2>
+	bool operator!=(const HashIterator<T1>& lhs, const HashIterator<T2>& rhs) {
+		return !(lhs == rhs);
+	}
+}
+
+#endif
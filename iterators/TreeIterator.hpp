@@ -6,25 +6,96 @@
 /*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/29 15:52:31 by doreshev          #+#    #+#             */
-/*   Updated: 2022/10/29 16:26:03 by doreshev         ###   ########.fr       */
+/*   Updated: 2026/10/18 07:46:40 by doreshev         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef TREEITERATOR_HPP
 # define TREEITERATOR_HPP
 
+# include <cstddef>
 # include "iterator.hpp"
 
 namespace ft {
 	//NODE STRUCT
+		// links and colour only: also the type of the sentinels embedded in
+		// ft::tree, so an empty tree owns no heap node
+		// FT_TREE_COMPACT_NODES keeps the colour in the low bit of the parent
+		// pointer (nodes are pointer aligned), 24 bytes instead of 32 on LP64;
+		// off by default so node sizes, hence max_size(), match the std tree
+	struct Node_base
+	{
+		Node_base*	left;
+		Node_base*	right;
+# ifdef FT_TREE_COMPACT_NODES
+		std::size_t	_parent_red;
+
+		Node_base*	parent() const { return reinterpret_cast<Node_base*>(_parent_red & ~std::size_t(1)); }
+		bool		red() const { return _parent_red & 1; }
+		void		set_parent(Node_base* p) { _parent_red = reinterpret_cast<std::size_t>(p) | (_parent_red & 1); }
+		void		set_red(bool r) { _parent_red = (_parent_red & ~std::size_t(1)) | static_cast<std::size_t>(r); }
+# else
+		Node_base*	_parent;
+		bool		_red;
+
+		Node_base*	parent() const { return _parent; }
+		bool		red() const { return _red; }
+		void		set_parent(Node_base* p) { _parent = p; }
+		void		set_red(bool r) { _red = r; }
+# endif
+		// FT_TREE_ORDER_STATISTICS adds the size of the subtree rooted at
+		// each node, kept up to date by the tree, for O(log n) rank and
+		// select (tree::select, tree::rank, iterator + n and distance)
+# ifdef FT_TREE_ORDER_STATISTICS
+		std::size_t	count;
+# endif
+	};
+# ifdef FT_TREE_ORDER_STATISTICS
+	//ORDER STATISTICS
+		// Nodes in the subtree rooted at node
+	inline std::size_t	node_count(const Node_base* node) {
+		return node == nullptr ? 0 : node->count;
+	}
+		// The end() sentinel of node's tree: the only node without a parent
+	inline Node_base*	node_header(Node_base* node) {
+		while (node->parent() != nullptr)
+			node = node->parent();
+		return node;
+	}
+		// Position of node in order, size() for the end() sentinel
+	inline std::size_t	node_index(const Node_base* node) {
+		if (node->parent() == nullptr)
+			return node_count(node->left);
+		std::size_t	index = node_count(node->left);
+
+		for (const Node_base* par = node->parent(); par->parent() != nullptr; par = par->parent()) {
+			if (node == par->right)
+				index += node_count(par->left) + 1;
+			node = par;
+		}
+		return index;
+	}
+		// Node at position k of the tree ending in header, or header
+	inline Node_base*	node_select(Node_base* header, std::size_t k) {
+		for (Node_base* node = header->left; node != nullptr; ) {
+			std::size_t	left = node_count(node->left);
+
+			if (k == left)
+				return node;
+			if (k < left)
+				node = node->left;
+			else {
+				k -= left + 1;
+				node = node->right;
+			}
+		}
+		return header;
+	}
+# endif
 	template <typename T>
-	struct Node
+	struct Node : public Node_base
 	{
 		T			value;
-		Node*		left;
-		Node*		right;
-		Node*		parent;
-		bool		red;
 	};
 	//MAP ITERATORS
 	template <class T, class TNode, class Tree>
@@ -32,6 +103,7 @@ namespace ft {
 	public:
 		typedef T															value_type;
 		typedef	TNode														node_type;
+		typedef Node_base*													base_ptr;
 		typedef T*															pointer;
 		typedef T&															reference;
     	typedef ptrdiff_t													difference_type;
@@ -42,9 +114,13 @@ namespace ft {
 		// 1) Default
 		TreeIterator() : _ptr() { }
 		// 2) Initialization
-		TreeIterator(const node_type& ptr) : _ptr(ptr) { }
+		TreeIterator(base_ptr ptr) : _ptr(ptr) { }
 		// 3) Copy
-		TreeIterator ( const TreeIterator<typename Tree::value_type, typename Tree::node_type *, Tree> & x ) :_ptr(x.base()) { }
+		TreeIterator ( const TreeIterator& x ) : _ptr(x.base()) { }
+		// 4) iterator to const_iterator: a template, so never the copy
+		//    constructor, and only taking the non-const node type
+		template <class U>
+		TreeIterator ( const TreeIterator<U, typename Tree::node_type *, Tree> & x ) :_ptr(x.base()) { }
 	// ASSIGN OPERATOR
 		TreeIterator& operator=( const TreeIterator& x ) {
 			if (*this != x)
@@ -54,8 +130,8 @@ namespace ft {
 	// DESTRUCTOR
 		~TreeIterator() { }
 	// MEMBER FUNCTIONS
-		// Base - returns base iterator
-		node_type	base() const {
+		// Base - returns the node, or the tree's end sentinel
+		base_ptr	base() const {
 			return _ptr;
 		}
 		// Pre-increment iterator position
@@ -66,10 +142,10 @@ namespace ft {
 					_ptr = _ptr->left;
 				return *this;
 			}
-			node_type par = _ptr->parent;
-			while (par->parent != nullptr && _ptr == par->right) {
+			base_ptr par = _ptr->parent();
+			while (par->parent() != nullptr && _ptr == par->right) {
 				_ptr = par;
-				par = par->parent;
+				par = par->parent();
 			}
 			_ptr = par;
 			return *this;
@@ -82,17 +158,17 @@ namespace ft {
 		}
 		// Dereference iterator
 		reference	operator*() const {
-			return _ptr->value;
+			return static_cast<node_type>(_ptr)->value;
 		}
 		reference	operator*() {
-			return _ptr->value;
+			return static_cast<node_type>(_ptr)->value;
 		}
 		// Dereference iterator
 		pointer operator->() const {
-			return &(_ptr->value);
+			return &(static_cast<node_type>(_ptr)->value);
 		}
 		pointer operator->() {
-			return &(_ptr->value);
+			return &(static_cast<node_type>(_ptr)->value);
 		}
 		// Pre-decrement iterator position
 		TreeIterator&	operator--() {
@@ -102,10 +178,10 @@ namespace ft {
 					_ptr = _ptr->right;
 				return *this;
 			}
-			node_type par = _ptr->parent;
-			while (par->parent != nullptr && _ptr == par->left) {
+			base_ptr par = _ptr->parent();
+			while (par->parent() != nullptr && _ptr == par->left) {
 				_ptr = par;
-				par = par->parent;
+				par = par->parent();
 			}
 			_ptr = par;
 			return *this;
@@ -117,19 +193,32 @@ namespace ft {
 			return temp;
 		}
 		// Addition operator
+# ifdef FT_TREE_ORDER_STATISTICS
+			// O(log n) through the subtree sizes: past either end is end()
+		TreeIterator	operator+ (difference_type n) const {
+			difference_type	index = static_cast<difference_type>(node_index(_ptr)) + n;
+			base_ptr		header = node_header(_ptr);
+
+			return TreeIterator(index < 0 ? header : node_select(header, index));
+		}
+		TreeIterator	operator- (difference_type n) const {
+			return *this + -n;
+		}
+# else
 		TreeIterator	operator+ (difference_type n) const {
 			TreeIterator temp = *this;
-			for (size_type i = 0; i < n; i++)
+			for (difference_type i = 0; i < n; i++)
 				temp++;
 			return temp;
 		}
 		// Subtraction operator
 		TreeIterator	operator- (difference_type n) const {
 			TreeIterator temp = *this;
-			for (size_type i = 0; i < n; i++)
+			for (difference_type i = 0; i < n; i++)
 				temp--;
 			return temp;
 		}
+# endif
 		bool operator==(const TreeIterator& x) const {
 			return _ptr == x._ptr;
 		}
@@ -137,26 +226,35 @@ namespace ft {
 			return !(_ptr == x._ptr);
 		}
 	protected:
-		node_type		_ptr;
+		base_ptr		_ptr;
 	};
 
 	//RELATIONAL OPERATORS 
+		// mixed iterator/const_iterator comparisons only within one tree type
 	template <class T, class T2, class tree>
 	bool operator==(const TreeIterator<T, T2, tree>& lhs, const TreeIterator<T, T2, tree>& rhs) {
 		return lhs.base() == rhs.base();
 	}
-	template <class T, class T1, class tree, class T2, class T12, class tree2>
-	bool operator==(const TreeIterator<T, T2, tree>& lhs, const TreeIterator<T1, T12, tree2>& rhs) {
+	template <class T, class T1, class tree, class T2, class T12>
+	bool operator==(const TreeIterator<T, T2, tree>& lhs, const TreeIterator<T1, T12, tree>& rhs) {
 		return lhs.base() == rhs.base();
 	}
 	template <class T, class T2, class tree>
 	bool operator!=(const TreeIterator<T, T2, tree>& lhs, const TreeIterator<T, T2, tree>& rhs) {
 		return lhs.base() != rhs.base();
 	}
-	template <class T, class T1, class tree, class T2, class T12, class tree2>
-	bool operator!=(const TreeIterator<T, T2, tree>& lhs, const TreeIterator<T1, T12, tree2>& rhs) {
+	template <class T, class T1, class tree, class T2, class T12>
+	bool operator!=(const TreeIterator<T, T2, tree>& lhs, const TreeIterator<T1, T12, tree>& rhs) {
 		return lhs.base() != rhs.base();
 	}
+# ifdef FT_TREE_ORDER_STATISTICS
+	//DISTANCE
+		// difference of the two positions instead of a walk
+	template <class T, class TNode, class tree>
+	ptrdiff_t	distance(const TreeIterator<T, TNode, tree>& first, const TreeIterator<T, TNode, tree>& last) {
+		return static_cast<ptrdiff_t>(node_index(last.base())) - static_cast<ptrdiff_t>(node_index(first.base()));
+	}
+# endif
 }
 
 #endif
\ No newline at end of file
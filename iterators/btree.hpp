@@ -0,0 +1,813 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:26:30 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:24:30 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_HPP
+# define BTREE_HPP
+
+# include <cstring>
+# include "../utility.hpp"
+# include "BtreeIterator.hpp"
+# include "../algorithm.hpp"
+# include "../type_traits.hpp"
+# include "../functional.hpp"
+
+// Target size of a B-tree node in bytes: 256 is four cache lines, so a
+// node is searched with a few sequential line fills instead of one miss
+// per level as in the red-black tree
+# ifndef FT_BTREE_NODE_BYTES
+#  define FT_BTREE_NODE_BYTES 256
+# endif
+
+namespace ft {
+//B-TREE IMPLEMENTATION
+	// ordered on Key like ft::tree, but every node keeps up to Slots values
+	// in sorted order (internal nodes also Slots + 1 children), so a lookup
+	// touches about log(n) / log(Slots) nodes. Values are relocated between
+	// nodes on insertion and erasure: any insertion or erasure invalidates
+	// all iterators. Values that may throw while relocated are never shifted
+	// in place, the nodes are rebuilt instead (see _insert_copy), so a
+	// throwing insertion or erasure leaves the tree unchanged
+template<class Key, class T, class KeyOfValue, class Compare, class Allocator>
+class btree {
+public:
+	enum { slots = BtreeSlots<T, FT_BTREE_NODE_BYTES>::value, min_values = slots / 2 };
+
+	typedef Key																	key_type;
+	typedef T																	value_type;
+	typedef BtreeNode<value_type, slots>										node_type;
+	typedef node_type*															node_ptr;
+	typedef BtreeInternal<value_type, slots>									internal_type;
+	typedef Compare																key_compare;
+	typedef Allocator															allocator_type;
+	typedef typename Allocator::template rebind<node_type>::other				leaf_allocator;
+	typedef typename Allocator::template rebind<internal_type>::other			internal_allocator;
+	typedef typename allocator_type::size_type									size_type;
+	typedef typename ft::BtreeIterator<value_type, node_type>					iterator;
+	typedef typename ft::BtreeIterator<const value_type, node_type>				const_iterator;
+	typedef typename ft::reverse_iterator<iterator>								reverse_iterator;
+	typedef typename ft::reverse_iterator<const_iterator>						const_reverse_iterator;
+	typedef typename std::ptrdiff_t												difference_type;
+	typedef typename ft::is_nothrow_relocatable<value_type>						nothrow_relocatable;
+
+protected:
+	allocator_type			_alloc;
+	leaf_allocator			_leaf_alloc;
+	internal_allocator		_internal_alloc;
+	key_compare				_compare;
+	node_ptr				_root;
+	size_type				_size;
+
+public:
+	//  CONSTRUCTORS AND DESTRUCTOR
+	btree(const key_compare& compare = key_compare(), const allocator_type& alloc = allocator_type())
+		: _alloc(alloc), _leaf_alloc(alloc), _internal_alloc(alloc), _compare(compare),
+			_root(nullptr), _size(0) { }
+	btree(const btree& x) : _alloc(x._alloc), _leaf_alloc(x._leaf_alloc), _internal_alloc(x._internal_alloc),
+							_compare(x._compare), _root(nullptr), _size(0) {
+		if (x._root != nullptr)
+			_root = _clone(x._root, nullptr);
+		_size = x._size;
+	}
+	~btree() {
+		clear();
+	}
+	btree& operator= (const btree& x) {
+		if (this != &x) {
+			clear();
+			_compare = x._compare;
+			if (x._root != nullptr)
+				_root = _clone(x._root, nullptr);
+			_size = x._size;
+		}
+		return *this;
+	}
+
+	size_type	max_size () const { return _leaf_alloc.max_size(); }
+	size_type	size () const { return _size; }
+	bool		empty () const { return _size == 0; }
+	// ITERATORS: the ends are found by walking down the leftmost or the
+	// rightmost spine, a few nodes
+	iterator begin () { return iterator(_leftmost(), 0); }
+	const_iterator begin () const { return const_iterator(_leftmost(), 0); }
+	iterator end () { return _end(); }
+	const_iterator end () const { return _end(); }
+	// 1) Insertion
+		// a) Single element
+	ft::pair<iterator, bool> insert(const value_type& val) {
+		iterator	pos;
+
+		if (insert_pos(_key(val), pos))
+			return ft::make_pair(pos, false);
+		return ft::make_pair(insert_at(pos, val), true);
+	}
+		// b) Next to a hint: appends through end() skip the search, which
+		//    keeps building from sorted input linear
+	iterator insert(const_iterator position, const value_type& val) {
+		if (position == end() && _root != nullptr) {
+			iterator	last = _end();
+
+			if (_compare(_key(*--iterator(last)), _key(val)))
+				return insert_at(last, val);
+		}
+		return insert(val).first;
+	}
+		// c) Where a new element with key k goes: true and the element when
+		//    k is already present, false and the leaf slot otherwise
+	template <class K>
+	bool	insert_pos(const K& k, iterator& pos) const {
+		node_ptr	node = _root;
+
+		if (node == nullptr) {
+			pos = iterator();
+			return false;
+		}
+		for (;;) {
+			int	i = _node_lower_bound(node, k);
+
+			if (i < node->count && !_compare(k, _key(node->value(i)))) {
+				pos = iterator(node, i);
+				return true;
+			}
+			if (node->leaf) {
+				pos = iterator(node, i);
+				return false;
+			}
+			node = node->child(i);
+		}
+	}
+		// d) Constructs val at a leaf slot from insert_pos, splitting full
+		//    nodes on the way up (see _insert_split)
+	iterator	insert_at(iterator pos, const value_type& val) {
+		node_ptr	node = pos.node();
+		int			i = pos.position();
+
+		if (node == nullptr) {
+			_root = _new_node(true);
+			node = _root;
+			i = 0;
+		}
+		else if (!nothrow_relocatable::value)
+			return _insert_copy(node, i, val);
+		else if (node->count == slots)
+			return _insert_split(node, i, val);
+		_shift_right(node, i);
+		try {
+			_alloc.construct(&node->value(i), val);
+		}
+		catch (...) {
+			_shift_left(node, i + 1);
+			if (node == _root && node->count == 0)
+				_drop_root();
+			throw;
+		}
+		_size++;
+		return iterator(node, i);
+	}
+	// 2) Lookup: K is key_type, or any type the comparator accepts
+	template <class K>
+	iterator	find(const K& k) {
+		iterator	pos;
+
+		return insert_pos(k, pos) ? pos : end();
+	}
+	template <class K>
+	const_iterator	find(const K& k) const {
+		iterator	pos;
+
+		return insert_pos(k, pos) ? pos : _end();
+	}
+	template <class K>
+	size_type	count(const K& k) const {
+		iterator	pos;
+
+		return insert_pos(k, pos);
+	}
+		// first value not less than k: the last candidate met on the way
+		// down is the smallest one
+	template <class K>
+	iterator	lower_bound(const K& k) const {
+		iterator	res = _end();
+
+		for (node_ptr node = _root; node != nullptr; ) {
+			int	i = _node_lower_bound(node, k);
+
+			if (i < node->count)
+				res = iterator(node, i);
+			node = node->leaf ? nullptr : node->child(i);
+		}
+		return res;
+	}
+		// first value greater than k
+	template <class K>
+	iterator	upper_bound(const K& k) const {
+		iterator	res = _end();
+
+		for (node_ptr node = _root; node != nullptr; ) {
+			int	i = _node_upper_bound(node, k);
+
+			if (i < node->count)
+				res = iterator(node, i);
+			node = node->leaf ? nullptr : node->child(i);
+		}
+		return res;
+	}
+	// 3) Deletion
+	void	erase(const const_iterator& pos) {
+		node_ptr	node = pos.node();
+		int			i = pos.position();
+
+		if (!nothrow_relocatable::value)
+			_erase_copy(node, i);
+		else if (node->leaf) {
+			_alloc.destroy(&node->value(i));
+			_shift_left(node, i + 1);
+		}
+		else {
+			// the in-order predecessor, the last value of a leaf, takes its place
+			node_ptr	leaf = node->child(i);
+
+			while (!leaf->leaf)
+				leaf = leaf->child(leaf->count);
+			_alloc.destroy(&node->value(i));
+			_relocate(&leaf->value(leaf->count - 1), &node->value(i), 1);
+			leaf->count--;
+			node = leaf;
+		}
+		if (nothrow_relocatable::value)
+			_rebalance(node);
+		_size--;
+	}
+	template <class K>
+	size_type	erase_key(const K& k) {
+		iterator	pos;
+
+		if (!insert_pos(k, pos))
+			return 0;
+		erase(pos);
+		return 1;
+	}
+	void	clear() {
+		if (_root != nullptr)
+			_destroy(_root);
+		_root = nullptr;
+		_size = 0;
+	}
+	// 4) Swap
+	void	swap(btree& x) {
+		ft::swap(_root, x._root);
+		ft::swap(_size, x._size);
+		ft::swap(_alloc, x._alloc);
+		ft::swap(_leaf_alloc, x._leaf_alloc);
+		ft::swap(_internal_alloc, x._internal_alloc);
+		ft::swap(_compare, x._compare);
+	}
+	// Number of nodes from the root to a leaf
+	size_type	height() const {
+		size_type	h = 0;
+
+		for (node_ptr node = _root; node != nullptr; node = node->leaf ? nullptr : node->child(0))
+			h++;
+		return h;
+	}
+
+private:
+	// UTILS
+		// 0) Keys and searches inside one node (binary, slots is small)
+	static const key_type&	_key(const value_type& val) { return KeyOfValue()(val); }
+	template <class K>
+	int		_node_lower_bound(node_ptr node, const K& k) const {
+		int	lo = 0;
+		int	hi = node->count;
+
+		while (lo < hi) {
+			int	mid = (lo + hi) / 2;
+
+			if (_compare(_key(node->value(mid)), k))
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return lo;
+	}
+	template <class K>
+	int		_node_upper_bound(node_ptr node, const K& k) const {
+		int	lo = 0;
+		int	hi = node->count;
+
+		while (lo < hi) {
+			int	mid = (lo + hi) / 2;
+
+			if (!_compare(k, _key(node->value(mid))))
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return lo;
+	}
+	node_ptr	_leftmost() const {
+		node_ptr	node = _root;
+
+		while (node != nullptr && !node->leaf)
+			node = node->child(0);
+		return node;
+	}
+	iterator	_end() const {
+		node_ptr	node = _root;
+
+		while (node != nullptr && !node->leaf)
+			node = node->child(node->count);
+		return iterator(node, node != nullptr ? node->count : 0);
+	}
+		// 1) Node allocation: a leaf, or an internal node with its children
+	node_ptr	_new_node(bool leaf) {
+		node_ptr	node;
+
+		if (leaf)
+			node = _leaf_alloc.allocate(1);
+		else
+			node = _internal_alloc.allocate(1);
+		node->parent = nullptr;
+		node->position = 0;
+		node->count = 0;
+		node->leaf = leaf;
+		return node;
+	}
+	void	_free_node(node_ptr node) {
+		if (node->leaf)
+			_leaf_alloc.deallocate(node, 1);
+		else
+			_internal_alloc.deallocate(static_cast<internal_type*>(node), 1);
+	}
+	void	_destroy(node_ptr node) {
+		if (!node->leaf)
+			for (int c = 0; c <= node->count; c++)
+				_destroy(node->child(c));
+		for (int i = 0; i < node->count; i++)
+			_alloc.destroy(&node->value(i));
+		_free_node(node);
+	}
+		//    Structural copy; on exception whatever was built is released
+	node_ptr	_clone(node_ptr src, node_ptr parent) {
+		node_ptr	node = _new_node(src->leaf);
+		int			c = 0;
+
+		node->parent = parent;
+		node->position = src->position;
+		try {
+			for (; node->count < src->count; node->count++)
+				_alloc.construct(&node->value(node->count), src->value(node->count));
+			if (!src->leaf)
+				for (; c <= src->count; c++)
+					node->child(c) = _clone(src->child(c), node);
+		}
+		catch (...) {
+			while (c-- > 0)
+				_destroy(node->child(c));
+			for (int i = 0; i < node->count; i++)
+				_alloc.destroy(&node->value(i));
+			_free_node(node);
+			throw;
+		}
+		return node;
+	}
+		// 2) Relocation of n values to raw storage, ranges may overlap. Only
+		//    used when it cannot throw: moved (copied in C++98) one at a time
+	void	_relocate(value_type* from, value_type* to, int n) {
+		_relocate(from, to, n, ft::is_trivially_copyable<value_type>());
+	}
+	void	_relocate(value_type* from, value_type* to, int n, true_type) {
+		std::memmove(static_cast<void*>(to), static_cast<void*>(from), n * sizeof(value_type));
+	}
+	void	_relocate(value_type* from, value_type* to, int n, false_type) {
+		if (to < from)
+			for (int i = 0; i < n; i++)
+				_relocate_one(from + i, to + i);
+		else
+			for (int i = n; i-- > 0; )
+				_relocate_one(from + i, to + i);
+	}
+	void	_relocate_one(value_type* from, value_type* to) {
+# if __cplusplus >= 201103L
+		_alloc.construct(to, std::move_if_noexcept(*from));
+# else
+		_alloc.construct(to, *from);
+# endif
+		_alloc.destroy(from);
+	}
+		//    Child c of node, relinked to it
+	void	_set_child(node_ptr node, int c, node_ptr kid) {
+		node->child(c) = kid;
+		kid->parent = node;
+		kid->position = static_cast<unsigned char>(c);
+	}
+		//    Opens a hole at value i (and child i + 1), count grows
+	void	_shift_right(node_ptr node, int i) {
+		_relocate(&node->value(i), &node->value(i + 1), node->count - i);
+		if (!node->leaf)
+			for (int c = node->count; c > i; c--)
+				_set_child(node, c + 1, node->child(c));
+		node->count++;
+	}
+		//    Closes the hole at value i - 1 (and child i), count shrinks
+	void	_shift_left(node_ptr node, int i) {
+		_relocate(&node->value(i), &node->value(i - 1), node->count - i);
+		if (!node->leaf)
+			for (int c = i + 1; c <= node->count; c++)
+				_set_child(node, c - 1, node->child(c));
+		node->count--;
+	}
+		// 3) Splits a full node around one value, which moves up into the
+		//    parent, and updates (node, i) to where position i ended up.
+		//    Appending to a node keeps it full and starts the new sibling
+		//    empty, so sorted insertion leaves full nodes behind
+	void	_split(node_ptr& node, int& i) {
+		node_ptr	sib = _new_node(node->leaf);
+		node_ptr	parent = node->parent;
+
+		try {
+			if (parent == nullptr) {
+				parent = _new_node(false);
+				_set_child(parent, 0, node);
+				_root = parent;
+			}
+			else if (parent->count == slots) {
+				int	pi = node->position;
+
+				_split(parent, pi);
+				parent = node->parent;
+			}
+		}
+		catch (...) {
+			_free_node(sib);
+			throw;
+		}
+		int	mid = (i == slots) ? slots - 1 : slots / 2;
+		int	pos = node->position;
+
+		sib->count = static_cast<unsigned char>(slots - mid - 1);
+		_relocate(&node->value(mid + 1), &sib->value(0), sib->count);
+		if (!node->leaf)
+			for (int c = 0; c <= sib->count; c++)
+				_set_child(sib, c, node->child(mid + 1 + c));
+		_shift_right(parent, pos);
+		_relocate(&node->value(mid), &parent->value(pos), 1);
+		_set_child(parent, pos + 1, sib);
+		node->count = static_cast<unsigned char>(mid);
+		if (i > mid) {
+			node = sib;
+			i -= mid + 1;
+		}
+	}
+		//    insert_at into a full leaf: val is copied aside before the
+		//    split, which may leave (node, i) in an empty sibling that a
+		//    failed copy could not take back. _split itself only throws
+		//    while allocating, before it changes the tree
+	iterator	_insert_split(node_ptr node, int i, const value_type& val) {
+		union {
+			char		bytes[sizeof(value_type)];
+			long double	align_ld;
+			long long	align_ll;
+			void*		align_p;
+		}				aside;
+		value_type*		staged = reinterpret_cast<value_type*>(aside.bytes);
+
+		_alloc.construct(staged, val);
+		try {
+			_split(node, i);
+		}
+		catch (...) {
+			_alloc.destroy(staged);
+			throw;
+		}
+		_shift_right(node, i);
+		_relocate(staged, &node->value(i), 1);
+		_size++;
+		return iterator(node, i);
+	}
+		// 4) After an erasure: a node below min_values takes a value from a
+		//    sibling, or merges with it when both fit in one node (which
+		//    takes a value from the parent, so the check moves up)
+	void	_rebalance(node_ptr node) {
+		while (node != _root && node->count < min_values) {
+			node_ptr	parent = node->parent;
+			int			s = node->position > 0 ? node->position - 1 : 0;
+			node_ptr	left = parent->child(s);
+			node_ptr	right = parent->child(s + 1);
+
+			if (left->count + right->count + 1 <= slots) {
+				_merge(parent, s);
+				node = parent;
+			}
+			else {
+				if (node == left)
+					_rotate_left(parent, s);
+				else
+					_rotate_right(parent, s);
+				break ;
+			}
+		}
+		if (_root->count == 0)
+			_drop_root();
+	}
+		//    An empty root goes away: the tree is empty, or shrinks by a level
+	void	_drop_root() {
+		node_ptr	old = _root;
+
+		_root = old->leaf ? nullptr : old->child(0);
+		if (_root != nullptr)
+			_root->parent = nullptr;
+		_free_node(old);
+	}
+		//    Children s and s + 1 of parent and the value between them
+		//    become one node
+	void	_merge(node_ptr parent, int s) {
+		node_ptr	left = parent->child(s);
+		node_ptr	right = parent->child(s + 1);
+		int			base = left->count + 1;
+
+		_relocate(&parent->value(s), &left->value(left->count), 1);
+		_relocate(&right->value(0), &left->value(base), right->count);
+		if (!left->leaf)
+			for (int c = 0; c <= right->count; c++)
+				_set_child(left, base + c, right->child(c));
+		left->count = static_cast<unsigned char>(base + right->count);
+		right->count = 0;
+		_free_node(right);
+		_shift_left(parent, s + 1);
+	}
+		//    One value goes from the left child through the parent to the right
+	void	_rotate_right(node_ptr parent, int s) {
+		node_ptr	left = parent->child(s);
+		node_ptr	right = parent->child(s + 1);
+
+		_relocate(&right->value(0), &right->value(1), right->count);
+		if (!right->leaf) {
+			for (int c = right->count; c >= 0; c--)
+				_set_child(right, c + 1, right->child(c));
+			_set_child(right, 0, left->child(left->count));
+		}
+		right->count++;
+		_relocate(&parent->value(s), &right->value(0), 1);
+		_relocate(&left->value(left->count - 1), &parent->value(s), 1);
+		left->count--;
+	}
+		//    and from the right child to the left
+	void	_rotate_left(node_ptr parent, int s) {
+		node_ptr	left = parent->child(s);
+		node_ptr	right = parent->child(s + 1);
+
+		_relocate(&parent->value(s), &left->value(left->count), 1);
+		left->count++;
+		if (!left->leaf)
+			_set_child(left, left->count, right->child(0));
+		_relocate(&right->value(0), &parent->value(s), 1);
+		_relocate(&right->value(1), &right->value(0), right->count - 1);
+		if (!right->leaf)
+			for (int c = 0; c < right->count; c++)
+				_set_child(right, c, right->child(c + 1));
+		right->count--;
+	}
+		// 5) Copy relocation, when moving a value may throw: the new content
+		//    of every node an insertion or erasure touches is drafted as
+		//    pointers to the values it keeps, built in fresh nodes, and the
+		//    tree is only relinked (the old nodes destroyed) once nothing can
+		//    throw anymore
+	struct _draft {
+		int					count;
+		bool				leaf;
+		const value_type*	value[slots + 1];
+		node_ptr			child[slots + 2];
+	};
+		//    Nodes built so far and the nodes they replace: a non-root node
+		//    has at least two children, so the height is below levels
+	struct _journal {
+		enum { levels = sizeof(size_type) * 8 + 1 };
+
+		node_ptr	built[2 * levels + 4];
+		node_ptr	old[2 * levels + 4];
+		int			nbuilt;
+		int			nold;
+
+		_journal() : nbuilt(0), nold(0) { }
+	};
+	static void	_draft_of(_draft& d, node_ptr node) {
+		d.count = node->count;
+		d.leaf = node->leaf;
+		for (int k = 0; k < node->count; k++)
+			d.value[k] = &node->value(k);
+		if (!node->leaf)
+			for (int c = 0; c <= node->count; c++)
+				d.child[c] = node->child(c);
+	}
+		//    Value v at i and kid at child c (i or i + 1)
+	static void	_draft_insert(_draft& d, int i, const value_type* v, int c, node_ptr kid) {
+		for (int k = d.count; k > i; k--)
+			d.value[k] = d.value[k - 1];
+		d.value[i] = v;
+		if (!d.leaf) {
+			for (int k = d.count + 1; k > c; k--)
+				d.child[k] = d.child[k - 1];
+			d.child[c] = kid;
+		}
+		d.count++;
+	}
+		//    Value i and child c (i or i + 1) taken out
+	static void	_draft_erase(_draft& d, int i, int c) {
+		for (int k = i; k + 1 < d.count; k++)
+			d.value[k] = d.value[k + 1];
+		if (!d.leaf)
+			for (int k = c; k < d.count; k++)
+				d.child[k] = d.child[k + 1];
+		d.count--;
+	}
+		//    Values [first, last) and children [first, last] of d copied to a
+		//    fresh node; children are relinked to it in _commit
+	node_ptr	_build(const _draft& d, int first, int last, _journal& j) {
+		node_ptr	node = _new_node(d.leaf);
+
+		j.built[j.nbuilt++] = node;
+		for (int k = first; k < last; k++, node->count++)
+			_alloc.construct(&node->value(node->count), *d.value[k]);
+		if (!d.leaf)
+			for (int c = first; c <= last; c++)
+				node->child(c - first) = d.child[c];
+		return node;
+	}
+	void	_rollback(_journal& j) {
+		for (int n = 0; n < j.nbuilt; n++) {
+			for (int k = 0; k < j.built[n]->count; k++)
+				_alloc.destroy(&j.built[n]->value(k));
+			_free_node(j.built[n]);
+		}
+	}
+		//    top replaces the old subtree root below parent (the root when
+		//    parent is null)
+	void	_commit(_journal& j, node_ptr top, node_ptr parent, int pos) {
+		for (int n = 0; n < j.nbuilt; n++)
+			if (!j.built[n]->leaf)
+				for (int c = 0; c <= j.built[n]->count; c++)
+					_set_child(j.built[n], c, j.built[n]->child(c));
+		for (int n = 0; n < j.nold; n++) {
+			for (int k = 0; k < j.old[n]->count; k++)
+				_alloc.destroy(&j.old[n]->value(k));
+			_free_node(j.old[n]);
+		}
+		if (parent != nullptr)
+			_set_child(parent, pos, top);
+		else {
+			_root = top;
+			if (top != nullptr)
+				top->parent = nullptr;
+		}
+	}
+		//    Insertion at leaf slot i: each full node on the way up is drafted
+		//    with the new value and split around the same value as _split
+	iterator	_insert_copy(node_ptr node, int i, const value_type& val) {
+		_journal			j;
+		_draft				d;
+		const value_type*	v = &val;
+		node_ptr			left = nullptr;
+		node_ptr			right = nullptr;
+		iterator			res;
+
+		try {
+			for (;;) {
+				if (node != nullptr) {
+					_draft_of(d, node);
+					j.old[j.nold++] = node;
+				}
+				else {
+					d.count = 0;
+					d.leaf = false;
+				}
+				if (left != nullptr)
+					d.child[i] = left;
+				_draft_insert(d, i, v, i + 1, right);
+				if (d.count <= slots) {
+					left = _build(d, 0, d.count, j);
+					if (d.leaf)
+						res = iterator(left, i);
+					break ;
+				}
+				int	mid = (i == slots) ? slots - 1 : slots / 2;
+				int	m = (i <= mid) ? mid + 1 : mid;
+
+				left = _build(d, 0, m, j);
+				right = _build(d, m + 1, d.count, j);
+				if (d.leaf)
+					res = (i < m) ? iterator(left, i) : iterator(right, i - m - 1);
+				v = d.value[m];
+				i = (node->parent != nullptr) ? node->position : 0;
+				node = node->parent;
+			}
+		}
+		catch (...) {
+			_rollback(j);
+			throw;
+		}
+		_commit(j, left, node != nullptr ? node->parent : nullptr, node != nullptr ? node->position : 0);
+		_size++;
+		return res;
+	}
+		//    Erasure of value i: an internal value is replaced by its in-order
+		//    predecessor, then the leaf is rebalanced as in _rebalance and
+		//    every changed node up to the one holding i is rebuilt
+	void	_erase_copy(node_ptr node, int i) {
+		_journal			j;
+		_draft				a;
+		_draft				b;
+		_draft				sd;
+		_draft*				d = &a;
+		_draft*				up = &b;
+		node_ptr			x = nullptr;
+		const value_type*	pred = nullptr;
+		int					xi = i;
+		bool				balance = true;
+		node_ptr			top = nullptr;
+
+		if (!node->leaf) {
+			x = node;
+			node = node->child(i);
+			while (!node->leaf)
+				node = node->child(node->count);
+			i = node->count - 1;
+			pred = &node->value(i);
+		}
+		_draft_of(*d, node);
+		_draft_erase(*d, i, i + 1);
+		try {
+			for (;;) {
+				j.old[j.nold++] = node;
+				if (node == x)
+					x = nullptr;
+				if (node == _root) {
+					top = (d->count > 0) ? _build(*d, 0, d->count, j) : d->leaf ? nullptr : d->child[0];
+					break ;
+				}
+				node_ptr	parent = node->parent;
+				int			p = node->position;
+
+				_draft_of(*up, parent);
+				if (parent == x)
+					up->value[xi] = pred;
+				if (!balance || d->count >= min_values) {
+					balance = false;
+					top = _build(*d, 0, d->count, j);
+					if (x == nullptr)
+						break ;
+					up->child[p] = top;
+				}
+				else {
+					int			s = p > 0 ? p - 1 : 0;
+					node_ptr	sib = parent->child(s == p ? p + 1 : s);
+					_draft&		l = (s == p) ? *d : sd;
+					_draft&		r = (s == p) ? sd : *d;
+
+					_draft_of(sd, sib);
+					j.old[j.nold++] = sib;
+					if (l.count + r.count + 1 <= slots) {
+						_draft_insert(l, l.count, up->value[s], l.count + 1, r.leaf ? nullptr : r.child[0]);
+						for (int k = 0; k < r.count; k++)
+							_draft_insert(l, l.count, r.value[k], l.count + 1, r.leaf ? nullptr : r.child[k + 1]);
+						up->child[s] = _build(l, 0, l.count, j);
+						_draft_erase(*up, s, s + 1);
+					}
+					else {
+						if (s == p) {
+							_draft_insert(l, l.count, up->value[s], l.count + 1, r.leaf ? nullptr : r.child[0]);
+							up->value[s] = r.value[0];
+							_draft_erase(r, 0, 0);
+						}
+						else {
+							_draft_insert(r, 0, up->value[s], 0, l.leaf ? nullptr : l.child[l.count]);
+							up->value[s] = l.value[l.count - 1];
+							_draft_erase(l, l.count - 1, l.count);
+						}
+						up->child[s] = _build(l, 0, l.count, j);
+						up->child[s + 1] = _build(r, 0, r.count, j);
+						balance = false;
+					}
+				}
+				ft::swap(d, up);
+				node = parent;
+			}
+		}
+		catch (...) {
+			_rollback(j);
+			throw;
+		}
+		_commit(j, top, node == _root ? nullptr : node->parent, node->position);
+	}
+};
+}
+
+#endif
@@ -0,0 +1,462 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hashtable.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:33:55 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:59:38 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASHTABLE_HPP
+# define HASHTABLE_HPP
+
+# include <cstring>
+# include "../utility.hpp"
+# include "HashIterator.hpp"
+# include "../algorithm.hpp"
+# include "../type_traits.hpp"
+# include "../functional.hpp"
+
+namespace ft {
+//HASH TABLE IMPLEMENTATION
+	// open addressing with Robin Hood linear probing: the values sit in one
+	// array of power-of-two capacity, next to an array of probe distances
+	// (1 for a value in its home slot, 0 for an empty slot). Along a run of
+	// occupied slots values are kept in home slot order, so a lookup stops
+	// as soon as it meets a value closer to its home than the key would
+	// be, insertion pushes the rest of the run one slot on, and erasure
+	// pulls it back (no tombstones). Insertion and erasure invalidate all
+	// iterators. When moving a value throws, or more values share a home
+	// slot than a byte can count, the table falls back to unordered slots
+	// (_degraded): lookups scan every slot and nothing is moved anymore,
+	// until the next rehash puts the values back in order
+template<class Key, class T, class KeyOfValue, class Hash, class KeyEqual, class Allocator>
+class hashtable {
+public:
+	typedef Key																	key_type;
+	typedef T																	value_type;
+	typedef Hash																hasher;
+	typedef KeyEqual															key_equal;
+	typedef Allocator															allocator_type;
+	typedef typename Allocator::template rebind<unsigned char>::other			dist_allocator;
+	typedef typename allocator_type::size_type									size_type;
+	typedef typename std::ptrdiff_t												difference_type;
+	typedef typename ft::HashIterator<value_type>								iterator;
+	typedef typename ft::HashIterator<const value_type>							const_iterator;
+
+	enum { min_capacity = 8, max_dist = 255 };
+
+protected:
+	allocator_type		_alloc;
+	dist_allocator		_dist_alloc;
+	hasher				_hash;
+	key_equal			_equal;
+	value_type*			_slots;
+	unsigned char*		_dist;		// _capacity + 1 bytes, the last one is 1
+	size_type			_capacity;	// 0 or a power of two
+	size_type			_size;
+	size_type			_threshold;	// largest size before growing
+	int					_shift;		// hash bits dropped to get a slot
+	float				_max_load;
+	bool				_degraded;	// values not in probe order, _dist only marks them
+
+public:
+	// CONSTRUCTORS
+	hashtable (size_type n, const hasher& hash, const key_equal& equal, const allocator_type& alloc) :
+			_alloc(alloc), _dist_alloc(alloc), _hash(hash), _equal(equal), _slots(nullptr), _dist(nullptr),
+			_capacity(0), _size(0), _threshold(0), _shift(0), _max_load(0.875f), _degraded(false) {
+		if (n > 0)
+			rehash(n);
+	}
+		// same capacity, every value copied to the same slot
+	hashtable (const hashtable& x) : _alloc(x._alloc), _dist_alloc(x._dist_alloc), _hash(x._hash), _equal(x._equal),
+			_slots(nullptr), _dist(nullptr), _capacity(0), _size(0), _threshold(0), _shift(0),
+			_max_load(x._max_load), _degraded(x._degraded) {
+		size_type	i = 0;
+
+		if (x._size == 0)
+			return ;
+		_allocate(x._capacity);
+		try {
+			for (; i < _capacity; i++)
+				if (x._dist[i] != 0)
+					_alloc.construct(_slots + i, x._slots[i]);
+		}
+		catch (...) {
+			while (i-- > 0)
+				if (x._dist[i] != 0)
+					_alloc.destroy(_slots + i);
+			_deallocate();
+			throw;
+		}
+		std::memcpy(_dist, x._dist, _capacity);
+		_size = x._size;
+	}
+	hashtable& operator= (const hashtable& x) {
+		if (this != &x) {
+			hashtable	tmp(x);
+
+			swap(tmp);
+		}
+		return *this;
+	}
+	~hashtable () {
+		clear();
+		_deallocate();
+	}
+	// CAPACITY
+	size_type	max_size () const { return _alloc.max_size(); }
+	size_type	size () const { return _size; }
+	bool		empty () const { return _size == 0; }
+	// ITERATORS
+		// the first occupied slot
+	iterator begin () {
+		iterator	it(_dist, _slots);
+
+		if (_size == 0)
+			return end();
+		return _dist[0] != 0 ? it : ++it;
+	}
+	const_iterator begin () const {
+		const_iterator	it(_dist, _slots);
+
+		if (_size == 0)
+			return end();
+		return _dist[0] != 0 ? it : ++it;
+	}
+	iterator end () { return iterator(_dist + _capacity, _slots + _capacity); }
+	const_iterator end () const { return const_iterator(_dist + _capacity, _slots + _capacity); }
+	// 1) Insertion
+		// a) Single element
+	ft::pair<iterator, bool> insert(const value_type& val) {
+		iterator	pos;
+
+		if (insert_pos(_key(val), pos))
+			return ft::make_pair(pos, false);
+		return ft::make_pair(insert_at(pos, val), true);
+	}
+		// b) Where a new element with key k goes: true and the element when
+		//    k is already present, false and the slot it would take otherwise
+	bool	insert_pos(const key_type& k, iterator& pos) const {
+		size_type	i;
+		unsigned	d;
+		bool		found = _capacity != 0 && _probe(k, i, d);
+
+		pos = _capacity == 0 ? iterator() : iterator(_dist + i, _slots + i);
+		return found;
+	}
+		// c) Constructs val at a slot from insert_pos, growing the table
+		//    first when it is full enough. A probe distance past max_dist
+		//    grows it too while that spreads the values, then degrades it
+	iterator	insert_at(iterator pos, const value_type& val) {
+		size_type	i = pos.base() - _slots;
+		unsigned	d = 0;
+
+		if (_size + 1 > _threshold) {
+			rehash(_capacity == 0 ? size_type(min_capacity) : _capacity * 2);
+			_probe(_key(val), i, d);
+		}
+		else
+			d = static_cast<unsigned>((i - _home(_key(val))) & (_capacity - 1)) + 1;
+		while (!_place(i, d, val)) {
+			if (_size < _capacity / 4)
+				_degraded = true;
+			else
+				rehash(_capacity * 2);
+			_probe(_key(val), i, d);
+		}
+		_size++;
+		return iterator(_dist + i, _slots + i);
+	}
+	// 2) Lookup
+	iterator	find(const key_type& k) {
+		size_type	i;
+		unsigned	d;
+
+		if (_capacity != 0 && _probe(k, i, d))
+			return iterator(_dist + i, _slots + i);
+		return end();
+	}
+	const_iterator	find(const key_type& k) const {
+		size_type	i;
+		unsigned	d;
+
+		if (_capacity != 0 && _probe(k, i, d))
+			return const_iterator(_dist + i, _slots + i);
+		return end();
+	}
+	size_type	count(const key_type& k) const {
+		size_type	i;
+		unsigned	d;
+
+		return _capacity != 0 && _probe(k, i, d);
+	}
+	// 3) Deletion
+	void	erase(const const_iterator& pos) {
+		_remove(pos.dist() - _dist);
+	}
+	size_type	erase_key(const key_type& k) {
+		size_type	i;
+		unsigned	d;
+
+		if (_capacity == 0 || !_probe(k, i, d))
+			return 0;
+		_remove(i);
+		return 1;
+	}
+		// keeps the slots
+	void	clear() {
+		if (!ft::is_trivially_destructible<value_type>::value)
+			for (size_type i = 0; i < _capacity; i++)
+				if (_dist[i] != 0)
+					_alloc.destroy(_slots + i);
+		if (_capacity != 0)
+			std::memset(_dist, 0, _capacity);
+		_size = 0;
+		_degraded = false;
+	}
+	// 4) Swap
+	void	swap(hashtable& x) {
+		ft::swap(_alloc, x._alloc);
+		ft::swap(_dist_alloc, x._dist_alloc);
+		ft::swap(_hash, x._hash);
+		ft::swap(_equal, x._equal);
+		ft::swap(_slots, x._slots);
+		ft::swap(_dist, x._dist);
+		ft::swap(_capacity, x._capacity);
+		ft::swap(_size, x._size);
+		ft::swap(_threshold, x._threshold);
+		ft::swap(_shift, x._shift);
+		ft::swap(_max_load, x._max_load);
+		ft::swap(_degraded, x._degraded);
+	}
+	// 5) Slots and load factor
+	size_type	bucket_count() const { return _capacity; }
+	float		load_factor() const { return _capacity == 0 ? 0.0f : static_cast<float>(_size) / _capacity; }
+	float		max_load_factor() const { return _max_load; }
+	void		max_load_factor(float ml) {
+		_max_load = ml < 0.125f ? 0.125f : (ml > 1.0f ? 1.0f : ml);
+		if (_capacity != 0)
+			rehash(0);
+	}
+		// Smallest power of two capacity holding max(n, size / max load)
+		// slots, so rehash(0) shrinks the table to fit (and puts a degraded
+		// table back in order)
+	void	rehash(size_type n) {
+		size_type	need = static_cast<size_type>(static_cast<double>(_size) / _max_load) + 1;
+		size_type	capacity = min_capacity;
+
+		if (n < need)
+			n = need;
+		while (capacity < n)
+			capacity *= 2;
+		if (_size == 0 && n <= 1)
+			capacity = 0;
+		if (capacity != _capacity || _degraded)
+			_rebuild(capacity);
+	}
+		// Room for n elements without growing
+	void	reserve(size_type n) {
+		rehash(static_cast<size_type>(static_cast<double>(n) / _max_load) + 1);
+	}
+	hasher		hash_function() const { return _hash; }
+	key_equal	key_eq() const { return _equal; }
+
+private:
+// HELPER FUNCTIONS
+	static const key_type&	_key(const value_type& val) { return KeyOfValue()(val); }
+		// Fibonacci hashing: the top bits of hash * 2^bits / golden ratio
+	size_type	_home(const key_type& k) const {
+		const std::size_t	golden = sizeof(std::size_t) > 4
+			? (static_cast<std::size_t>(0x9E3779B9UL) << 16 << 16) | 0x7F4A7C15UL : 0x9E3779B9UL;
+
+		return (static_cast<std::size_t>(_hash(k)) * golden) >> _shift;
+	}
+		// Walks from the home slot of k: true with its slot when present,
+		// else false with the slot and probe distance a new k would take
+	bool	_probe(const key_type& k, size_type& i, unsigned& d) const {
+		size_type	mask = _capacity - 1;
+
+		if (_degraded)
+			return _scan(k, i, d);
+		i = _home(k);
+		for (d = 1; _dist[i] >= d; d++) {
+			if (_dist[i] == d && _equal(_key(_slots[i]), k))
+				return true;
+			i = (i + 1) & mask;
+		}
+		return false;
+	}
+		//    Degraded table: compares every value, a new k takes the first
+		//    empty slot from its home
+	bool	_scan(const key_type& k, size_type& i, unsigned& d) const {
+		for (i = 0; i < _capacity; i++)
+			if (_dist[i] != 0 && _equal(_key(_slots[i]), k))
+				return true;
+		i = _vacant(_home(k));
+		d = 1;
+		return false;
+	}
+		//    First empty slot from i on
+	size_type	_vacant(size_type i) const {
+		while (_dist[i] != 0)
+			i = (i + 1) & (_capacity - 1);
+		return i;
+	}
+		// Puts val at slot i, d slots away from its home, after moving the
+		// run from i to the next empty slot one slot on. False, with nothing
+		// changed, when a probe distance would not fit in a byte. A move
+		// that throws leaves its source in place and the slot it was going
+		// to empty, so the table degrades instead of losing track of it
+	bool	_place(size_type i, unsigned d, const value_type& val) {
+		size_type	mask = _capacity - 1;
+		size_type	e = i;
+
+		if (_degraded) {
+			_alloc.construct(_slots + i, val);
+			_dist[i] = 1;
+			return true;
+		}
+		if (d > max_dist)
+			return false;
+		for (; _dist[e] != 0; e = (e + 1) & mask)
+			if (_dist[e] == max_dist)
+				return false;
+		try {
+			for (; e != i; e = (e - 1) & mask) {
+				size_type	from = (e - 1) & mask;
+
+				_relocate(_slots + from, _slots + e);
+				_dist[e] = static_cast<unsigned char>(_dist[from] + 1);
+				_dist[from] = 0;
+			}
+		}
+		catch (...) {
+			_degraded = true;
+			throw;
+		}
+		try {
+			_alloc.construct(_slots + i, val);
+		}
+		catch (...) {
+			_pull_back(i);
+			throw;
+		}
+		_dist[i] = static_cast<unsigned char>(d);
+		return true;
+	}
+		// Destroys the value at slot i and closes the gap
+	void	_remove(size_type i) {
+		_alloc.destroy(_slots + i);
+		_dist[i] = 0;
+		_pull_back(i);
+		_size--;
+	}
+		// Moves the values after the empty slot i that are not in their
+		// home slot one slot back. Never throws: when a move does, the
+		// table degrades with slot i left empty
+	void	_pull_back(size_type i) {
+		size_type	mask = _capacity - 1;
+
+		if (_degraded)
+			return ;
+		try {
+			for (size_type next = (i + 1) & mask; _dist[next] > 1; next = (next + 1) & mask) {
+				_relocate(_slots + next, _slots + i);
+				_dist[i] = static_cast<unsigned char>(_dist[next] - 1);
+				_dist[next] = 0;
+				i = next;
+			}
+		}
+		catch (...) {
+			_degraded = true;
+		}
+	}
+		//    Moves with std::move_if_noexcept in C++11, copies in C++98
+	void	_relocate(value_type* from, value_type* to) {
+		_relocate(from, to, ft::is_trivially_copyable<value_type>());
+	}
+	void	_relocate(value_type* from, value_type* to, true_type) {
+		std::memcpy(static_cast<void*>(to), static_cast<void*>(from), sizeof(value_type));
+	}
+	void	_relocate(value_type* from, value_type* to, false_type) {
+# if __cplusplus >= 201103L
+		_alloc.construct(to, std::move_if_noexcept(*from));
+# else
+		_alloc.construct(to, *from);
+# endif
+		_alloc.destroy(from);
+	}
+	void	_allocate(size_type capacity) {
+		int	bits = 0;
+
+		_slots = _alloc.allocate(capacity);
+		try {
+			_dist = _dist_alloc.allocate(capacity + 1);
+		}
+		catch (...) {
+			_alloc.deallocate(_slots, capacity);
+			_slots = nullptr;
+			throw;
+		}
+		std::memset(_dist, 0, capacity);
+		_dist[capacity] = 1;
+		_capacity = capacity;
+		while ((size_type(1) << bits) < capacity)
+			bits++;
+		_shift = static_cast<int>(sizeof(std::size_t) * 8) - bits;
+		_threshold = static_cast<size_type>(capacity * static_cast<double>(_max_load));
+		if (_threshold >= capacity)
+			_threshold = capacity - 1;
+	}
+	void	_deallocate() {
+		if (_capacity == 0)
+			return ;
+		_alloc.deallocate(_slots, _capacity);
+		_dist_alloc.deallocate(_dist, _capacity + 1);
+		_slots = nullptr;
+		_dist = nullptr;
+		_capacity = 0;
+		_threshold = 0;
+	}
+		// Copies every value into a table of the given capacity, the old
+		// table is kept when that fails. Values are placed in probe order
+		// until a distance overflows, the rest go to the first empty slot
+	void	_rebuild(size_type capacity) {
+		hashtable	old(0, _hash, _equal, _alloc);
+
+		old._max_load = _max_load;
+		swap(old);
+		if (capacity == 0)
+			return ;
+		try {
+			_allocate(capacity);
+			for (size_type j = 0; j < old._capacity; j++)
+				if (old._dist[j] != 0) {
+					size_type	i = 0;
+					unsigned	d = 0;
+
+					if (!_degraded)
+						_probe(_key(old._slots[j]), i, d);
+					if (_degraded || !_place(i, d, old._slots[j])) {
+						_degraded = true;
+						_place(_vacant(_home(_key(old._slots[j]))), 1, old._slots[j]);
+					}
+					_size++;
+				}
+		}
+		catch (...) {
+			clear();
+			_deallocate();
+			swap(old);
+			throw;
+		}
+	}
+};
+
+}
+
+#endif
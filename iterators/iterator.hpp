@@ -6,7 +6,7 @@
 /*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/08 16:04:32 by doreshev          #+#    #+#             */
-/*   Updated: 2022/11/14 12:16:15 by doreshev         ###   ########.fr       */
+/*   Updated: 2026/10/18 08:00:33 by doreshev         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -140,9 +140,12 @@ namespace ft {
 			_iter += n;
 			return *this;
 		}
-		// Dereference iterator
+		// Dereference iterator: asks the base iterator, whose operator->
+		// may return a proxy rather than an address (flat_map)
 		pointer operator->() const {
-			return &(operator*());
+			iterator_type	tmp = _iter;
+
+			return _arrow(--tmp);
 		}
 		// Dereference iterator with offset
 		reference	operator[] (difference_type n) const {
@@ -154,6 +157,11 @@ namespace ft {
 		}
 	protected:
 		iterator_type		_iter;
+	private:
+		template <class It>
+		static pointer	_arrow(const It& it) { return it.operator->(); }
+		template <class P>
+		static pointer	_arrow(P* ptr) { return ptr; }
 	};
 
 	//RELATIONAL OPERATORS 
@@ -224,6 +232,30 @@ namespace ft {
 			return reverse_iterator<Iterator>(it.base() - n);
 	}
 
+	//BACK INSERT ITERATOR
+		// output iterator appending through push_back
+	template <class Container>
+	class back_insert_iterator : public ft::iterator<output_iterator_tag, void, void, void, void> {
+	public:
+		typedef Container	container_type;
+
+		explicit back_insert_iterator(Container& x) : _container(&x) { }
+		back_insert_iterator&	operator=(const typename Container::value_type& val) {
+			_container->push_back(val);
+			return *this;
+		}
+		back_insert_iterator&	operator*() { return *this; }
+		back_insert_iterator&	operator++() { return *this; }
+		back_insert_iterator	operator++(int) { return *this; }
+	protected:
+		Container*	_container;
+	};
+
+	template <class Container>
+	back_insert_iterator<Container>	back_inserter(Container& x) {
+		return back_insert_iterator<Container>(x);
+	}
+
 	//Distance function
 	template<class Iterator>
 	typename ft::iterator_traits<Iterator>::difference_type
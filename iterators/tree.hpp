@@ -6,26 +6,53 @@
 /*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/08 16:06:43 by doreshev          #+#    #+#             */
-/*   Updated: 2022/11/15 12:24:05 by doreshev         ###   ########.fr       */
+/*   Updated: 2026/10/18 08:42:58 by doreshev         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef TREE_HPP
 # define TREE_HPP
 
+# include <new>
 # include "../utility.hpp"
 # include "TreeIterator.hpp"
 # include "../algorithm.hpp"
+# include "../type_traits.hpp"
+# include "../functional.hpp"
 
 namespace ft {
+// Allocator hook for tree::clear: an allocator that can free all the nodes
+// of a tree at once overloads it (see pool_allocator.hpp)
+template <class Alloc>
+bool	release_all(Alloc&, std::size_t) { return false; }
+
+# ifdef FT_TREE_STATS
+// Shape and rebalancing work of a tree (FT_TREE_STATS), see tree::statistics
+struct tree_stats {
+	std::size_t	height;					// nodes on the longest path from the root
+	std::size_t	black_height;			// black nodes on any path from the root
+	double		average_depth;			// nodes visited to find an element, on average
+	std::size_t	rotations;				// counted since the last reset_statistics()
+	std::size_t	recolors;
+	std::size_t	del_rebalance_loops;	// iterations of the erase fix-up loop
+
+	tree_stats() : height(0), black_height(0), average_depth(0), rotations(0),
+		recolors(0), del_rebalance_loops(0) { }
+};
+# endif
+
 //TREE IMPLEMENTATION
-template<class T, class Compare, class Allocator>
+	// ordered on Key, which KeyOfValue extracts from each stored T
+	// (ft::identity for set, ft::select_first for map)
+template<class Key, class T, class KeyOfValue, class Compare, class Allocator>
 class tree {
 public:
+	typedef Key																	key_type;
 	typedef T																	value_type;
 	typedef Node<value_type>													node_type;
 	typedef node_type*															pointer;
-	typedef Compare																value_compare;
+	typedef Node_base*															base_ptr;
+	typedef Compare																key_compare;
 	typedef Allocator															allocator_type;
 	typedef typename Allocator::template rebind<node_type>::other				node_allocator;
 	typedef typename allocator_type::size_type									size_type;
@@ -38,103 +65,247 @@ public:
 protected:
 	allocator_type			_alloc;
 	node_allocator			_node_alloc;
-	value_compare			_compare;
-	pointer					_root;
-	pointer					_head;
-	pointer					_nil;
+	key_compare				_compare;
+	Node_base				_header;	// end() sentinel: left is _head, right the last element
+	Node_base				_leaf;		// stands for a null black leaf while erasing
+	base_ptr				_head;
 	size_type				_size;
+# ifdef FT_TREE_STATS
+	tree_stats				_stats;		// rebalancing counters only
+# endif
 
 public:
 	//  CONSTRUCTORS AND DESTRUCTOR
-	tree(const value_compare& compare = value_compare(), const allocator_type& alloc = allocator_type())
-		: _alloc(alloc), _node_alloc(alloc), _compare(compare), _root(_null_leaf_alloc()),
-			_head(nullptr), _nil(_null_leaf_alloc()), _size(0) { }
+	tree(const key_compare& compare = key_compare(), const allocator_type& alloc = allocator_type())
+		: _alloc(alloc), _node_alloc(alloc), _compare(compare), _header(), _leaf(),
+			_head(nullptr), _size(0) { }
 	tree (const tree& x) :	_alloc(x._alloc), _node_alloc(x._node_alloc), _compare(x._compare),
-							_root(_null_leaf_alloc()), _head(nullptr), _nil(_null_leaf_alloc()), _size(0) {
+							_header(), _leaf(), _head(nullptr), _size(0) {
 		_copy_tree(x._head);
-		_root->left = _head;
 	}
 	~tree() {
 		clear();
-		_node_alloc.deallocate(_root, 1);
-		_node_alloc.deallocate(_nil, 1);
 	}
 	tree& operator= (const tree& x) {
 		if (this != &x) {
-			_alloc = x._alloc;
-			_node_alloc = x._node_alloc;
 			_compare = x._compare;
 			clear();
 			_copy_tree(x._head);
-			_root->left = _head;
 		}
 		return *this;
 	}
 
 	size_type	max_size () const { return _node_alloc.max_size(); }
 	size_type	size () const { return _size; }
-	// 1)Insertion of single element
+	// 1) Insertion
+		// a) Single element: descends from the root
 	ft::pair<iterator, bool> insert(const value_type& val) {
-		if (_head == nullptr) {
-			_head = _nallocate(val);
-			_head->red = false;
-			_head->parent = _root;
-			_root->left = _head;
-			_size++;
-			return ft::make_pair(iterator(_head), true);
-		}
-		for ( pointer tmp = _head; tmp != nullptr; ) {
-			if (!_compare(tmp->value, val)) {
-				if (!_compare(val, tmp->value))
-					return ft::make_pair(iterator(tmp), false);
-				if (tmp->left == nullptr) {
-					tmp->left = _nallocate(val);
-					tmp->left->parent = tmp;
-					tmp = tmp->left;
-					_ins_balance(tmp);
-					_size++;
-					return ft::make_pair(iterator(tmp), true);
-				}
-				tmp = tmp->left;
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = insert_pos(_key(val), parent, left);
+
+		if (found != nullptr)
+			return ft::make_pair(iterator(found), false);
+		return ft::make_pair(iterator(_insert_at(parent, left, val)), true);
+	}
+		// b) Next to a hint
+	iterator insert(const_iterator position, const value_type& val) {
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = insert_hint_pos(position, _key(val), parent, left);
+
+		if (found != nullptr)
+			return iterator(found);
+		return iterator(_insert_at(parent, left, val));
+	}
+		// c) Where a new element with key k goes: returns the element that
+		//    already has key k, or nullptr after setting parent and the side
+		//    (left or right) to link it on, for insert_at/emplace_at
+	base_ptr	insert_pos(const key_type& k, base_ptr& parent, bool& left) const {
+		parent = _end();
+		left = true;
+		for (base_ptr tmp = _head; tmp != nullptr; ) {
+			parent = tmp;
+			left = !_compare(_key(_value(tmp)), k);
+			if (left && !_compare(k, _key(_value(tmp))))
+				return tmp;
+			tmp = left ? tmp->left : tmp->right;
+		}
+		return nullptr;
+	}
+		//    Same next to a hint: when k belongs right before or right after
+		//    hint the slot is found after one or two comparisons, appends
+		//    through end() or the last element are amortized O(1)
+	base_ptr	insert_hint_pos(const const_iterator& position, const key_type& k, base_ptr& parent, bool& left) const {
+		base_ptr	hint = position.base();
+		base_ptr	last = _end()->right;
+
+		if (hint == _end()) {
+			if (last != nullptr && _compare(_key(_value(last)), k))
+				return _slot(last, false, parent, left);
+		}
+		else if (_compare(k, _key(_value(hint)))) {
+			base_ptr	prev = predecessor(hint);
+
+			if (prev == _end() || _compare(_key(_value(prev)), k)) {
+				if (hint->left == nullptr)
+					return _slot(hint, true, parent, left);
+				return _slot(prev, false, parent, left);
 			}
-			else {
-				if (tmp->right == nullptr) {
-					tmp->right = _nallocate(val);
-					tmp->right->parent = tmp;
-					tmp = tmp->right;
-					_ins_balance(tmp);
-					_size++;
-					return ft::make_pair(iterator(tmp), true);
-				}
-				tmp = tmp->right;
+		}
+		else if (_compare(_key(_value(hint)), k)) {
+			if (hint == last)
+				return _slot(hint, false, parent, left);
+			base_ptr	next = successor(hint);
+
+			if (_compare(k, _key(_value(next)))) {
+				if (hint->right == nullptr)
+					return _slot(hint, false, parent, left);
+				return _slot(next, true, parent, left);
 			}
 		}
-		return (ft::make_pair(iterator(_root), false));
+		else
+			return hint;
+		return insert_pos(k, parent, left);
+	}
+		// d) Links a new element built from val at a slot from insert_pos
+	iterator	insert_at(base_ptr parent, bool left, const value_type& val) {
+		return iterator(_insert_at(parent, left, val));
+	}
+# if __cplusplus >= 201103L
+		//    or constructs it there in place from args
+	template <class... Args>
+	iterator	emplace_at(base_ptr parent, bool left, Args&&... args) {
+		return iterator(_link_at(parent, left, _nconstruct(std::forward<Args>(args)...)));
+	}
+# else
+		//    or constructs it there in place from (tag, key[, obj]), so map
+		//    never copies a temporary value_type into the node
+	template <class A1, class A2>
+	iterator	emplace_at(base_ptr parent, bool left, const A1& a1, const A2& a2) {
+		return iterator(_link_at(parent, left, _nconstruct(a1, a2)));
+	}
+	template <class A1, class A2, class A3>
+	iterator	emplace_at(base_ptr parent, bool left, const A1& a1, const A2& a2, const A3& a3) {
+		return iterator(_link_at(parent, left, _nconstruct(a1, a2, a3)));
+	}
+# endif
+# if __cplusplus >= 201103L
+		// e) Builds the element first, its key is only known afterwards:
+		//    the node is dropped again when the key is already present
+	template <class... Args>
+	ft::pair<iterator, bool>	emplace_unique(Args&&... args) {
+		pointer		node = _nconstruct(std::forward<Args>(args)...);
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = insert_pos(_key(node->value), parent, left);
+
+		if (found != nullptr) {
+			_drop_node(node);
+			return ft::make_pair(iterator(found), false);
+		}
+		return ft::make_pair(iterator(_link_at(parent, left, node)), true);
+	}
+	template <class... Args>
+	iterator	emplace_hint_unique(const const_iterator& position, Args&&... args) {
+		pointer		node = _nconstruct(std::forward<Args>(args)...);
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = insert_hint_pos(position, _key(node->value), parent, left);
+
+		if (found != nullptr) {
+			_drop_node(node);
+			return iterator(found);
+		}
+		return iterator(_link_at(parent, left, node));
+	}
+# endif
+		// f) Equivalent keys allowed (multimap, multiset): after the last
+		//    element equivalent to val
+	iterator	insert_equal(const value_type& val) {
+		base_ptr	parent;
+		bool		left;
+
+		insert_equal_pos(_key(val), parent, left, false);
+		return iterator(_insert_at(parent, left, val));
+	}
+		//    or as close before the hint as the order allows, like the std
+		//    tree; appends through end() are amortized O(1)
+	iterator	insert_equal(const const_iterator& position, const value_type& val) {
+		base_ptr	parent;
+		bool		left;
+
+		insert_equal_hint_pos(position, _key(val), parent, left);
+		return iterator(_insert_at(parent, left, val));
+	}
+		//    Slot for a key that may already be present: after its last
+		//    equivalent element, or before the first one when lower is set
+	void	insert_equal_pos(const key_type& k, base_ptr& parent, bool& left, bool lower) const {
+		parent = _end();
+		left = true;
+		for (base_ptr tmp = _head; tmp != nullptr; ) {
+			parent = tmp;
+			left = lower ? !_compare(_key(_value(tmp)), k) : _compare(k, _key(_value(tmp)));
+			tmp = left ? tmp->left : tmp->right;
+		}
+	}
+	void	insert_equal_hint_pos(const const_iterator& position, const key_type& k, base_ptr& parent, bool& left) const {
+		base_ptr	hint = position.base();
+		base_ptr	last = _end()->right;
+
+		if (hint == _end()) {
+			if (last != nullptr && !_compare(k, _key(_value(last))))
+				_slot(last, false, parent, left);
+			else
+				insert_equal_pos(k, parent, left, false);
+		}
+		else if (!_compare(_key(_value(hint)), k)) {
+			base_ptr	prev = predecessor(hint);
+
+			if (prev == _end())
+				_slot(hint, true, parent, left);
+			else if (!_compare(k, _key(_value(prev))))
+				_slot(prev->right == nullptr ? prev : hint, prev->right != nullptr, parent, left);
+			else
+				insert_equal_pos(k, parent, left, false);
+		}
+		else {
+			base_ptr	next = successor(hint);
+
+			if (hint == last)
+				_slot(hint, false, parent, left);
+			else if (!_compare(_key(_value(next)), k))
+				_slot(hint->right == nullptr ? hint : next, hint->right != nullptr, parent, left);
+			else
+				insert_equal_pos(k, parent, left, true);
+		}
 	}
 	iterator begin () {
 		if (_head == nullptr)
-			return iterator(_root);
+			return iterator(_end());
 		return iterator(node_minimum(_head)); 
 	}
 	const_iterator begin () const {
 		if (_head == nullptr)
-			return const_iterator(_root);
+			return const_iterator(_end());
 		return const_iterator(node_minimum(_head)); 
 	}
-	iterator end () { return iterator(_root); }
-	const_iterator end () const { return const_iterator(_root);	}
+	iterator end () { return iterator(_end()); }
+	const_iterator end () const { return const_iterator(_end());	}
 	// Checks if tree is empty
 	bool empty () const {
 		if (_size == 0)
 			return true;
 		return false;
 	}
-	// 2) Find
-	pointer find(const value_type& key) const {
-		for ( pointer tmp = _head; tmp != nullptr; ) {
-			if (!_compare(tmp->value, key)) {
-				if (!_compare(key, tmp->value))
-					return tmp;
+	// 2) Find: K is key_type, or any type the comparator accepts
+	//    alongside it when it is transparent
+	template <class K>
+	pointer find(const K& key) const {
+		for ( base_ptr tmp = _head; tmp != nullptr; ) {
+			if (!_compare(_key(_value(tmp)), key)) {
+				if (!_compare(key, _key(_value(tmp))))
+					return static_cast<pointer>(tmp);
 				if (tmp->left == nullptr)
 					return nullptr;
 				tmp = tmp->left;
@@ -149,48 +320,91 @@ public:
 		return nullptr;
 	}
 		// for iterator
-	pointer iter_find(const value_type& key) const {
-		for ( pointer tmp = _head; tmp != nullptr; ) {
-			if (!_compare(tmp->value, key)) {
-				if (!_compare(key, tmp->value))
+	template <class K>
+	base_ptr iter_find(const K& key) const {
+		for ( base_ptr tmp = _head; tmp != nullptr; ) {
+			if (!_compare(_key(_value(tmp)), key)) {
+				if (!_compare(key, _key(_value(tmp))))
 					return tmp;
 				if (tmp->left == nullptr)
-					return _root;
+					return _end();
 				tmp = tmp->left;
 			}
 			else {
 				if (tmp->right == nullptr) {
-					return _root;
+					return _end();
 				}
 				tmp = tmp->right;
 			}
 		}
-		return _root;
+		return _end();
+	}
+		// first of the elements equivalent to key, which std multimap and
+		// multiset find return
+	template <class K>
+	base_ptr find_first(const K& key) const {
+		base_ptr	res = _lower_bound(key);
+
+		if (res == _end() || _compare(key, _key(_value(res))))
+			return _end();
+		return res;
 	}
 	// 3) Deletion
-	void	erase (pointer pos) {
-		if (pos == nullptr || pos == _root)
+	void	erase (base_ptr pos) {
+		if (pos == nullptr || pos == _end())
 			return ;
 		if (_size == 1 && pos == _head) {
 			_del_node(pos);
 			_head = nullptr;
-			_root->left = nullptr;
+			_end()->left = nullptr;
+			_end()->right = nullptr;
 			return ;
 		}
 		_rb_deletion(pos);
 	}
-	size_type erase (const value_type& k) {
-		pointer pos = find(k);
+	size_type erase (const key_type& k) {
+		base_ptr pos = find(k);
 		if (pos == nullptr)
 			return 0;
 		_rb_deletion(pos);
 		return 1;
+	}
+		//    every element equivalent to k
+	template <class K>
+	size_type	erase_equal (const K& k) {
+		ft::pair<base_ptr, base_ptr>	range = equal_range(k);
+
+		return erase(range.first, range.second);
+	}
+		//    every element in [first, last): the successor is taken before
+		//    each deletion, so nothing is searched again, and deleting in
+		//    order rebalances in amortized O(1); the whole tree goes through
+		//    clear(), which frees without relinking anything
+	size_type	erase (base_ptr first, base_ptr last) {
+		size_type	n = 0;
+
+		if (first == begin().base() && last == _end()) {
+			n = _size;
+			clear();
+			return n;
+		}
+		while (first != last) {
+			base_ptr	next = successor(first);
+
+			erase(first);
+			first = next;
+			n++;
+		}
+		return n;
 	}
 	void	clear() {
-		_clear(_head);
+		if (_head != nullptr && !(ft::is_trivially_destructible<value_type>::value && _release_nodes()))
+			_clear(_head);
 		_head = nullptr;
+		_end()->left = nullptr;
+		_end()->right = nullptr;
 	}
-	void	_clear(pointer head) {
+	void	_clear(base_ptr head) {
 		if (head == nullptr)
 			return ;
 		_clear(head->left);
@@ -199,64 +413,227 @@ public:
 	}
 	// 4) Swap
 	void swap (tree& x) {
-		ft::swap(_root, x._root);
 		ft::swap(_head, x._head);
+		ft::swap(_header.right, x._header.right);
+		_header.left = _head;
+		x._header.left = x._head;
+		if (_head != nullptr)
+			_head->set_parent(_end());
+		if (x._head != nullptr)
+			x._head->set_parent(x._end());
 		ft::swap(_node_alloc, x._node_alloc);
 		ft::swap(_alloc, x._alloc);
 		ft::swap(_compare, x._compare);
 		ft::swap(_size, x._size);
 	}
 	// 5) Count
-	size_type count (const value_type& k) const {
+	template <class K>
+	size_type count (const K& k) const {
 		if (find(k) == nullptr)
 			return 0;
 		return 1;
 	}
 	// 6) lower/upper bound
-	iterator lower_bound (const value_type& k) {
-		iterator it = begin();
-		iterator last = end();
-		while (it != last && _compare(*it, k))
-			it++;
-		return it;
-	}
-	const_iterator lower_bound (const value_type& k) const {
-		const_iterator it = begin();
-		const_iterator last = end();
-		while (it != last && _compare(*it, k))
-			it++;
-		return it;
+		// first element not less than k, root-to-leaf descent
+	template <class K>
+	iterator lower_bound (const K& k) {
+		return iterator(_lower_bound(k));
+	}
+	template <class K>
+	const_iterator lower_bound (const K& k) const {
+		return const_iterator(_lower_bound(k));
 	}
 	// 5) Return iterator to upper bound
-	iterator upper_bound (const value_type& k) {
-		iterator it = end();
-		iterator first = begin();
-		for (iterator tmp = it; it != first; it--) {
-			tmp--;
-			if (!_compare(k, *tmp))
-				return it;
-		}
-		return it;
-	}
-	const_iterator upper_bound (const value_type& k) const {
-		const_iterator it = end();
-		const_iterator first = begin();
-		for (const_iterator tmp = it; it != first; it--) {
-			tmp--;
-			if (!_compare(k, *tmp))
-				return it;
-		}
-		return it;
+		// first element greater than k, root-to-leaf descent
+	template <class K>
+	iterator upper_bound (const K& k) {
+		return iterator(_upper_bound(k));
+	}
+	template <class K>
+	const_iterator upper_bound (const K& k) const {
+		return const_iterator(_upper_bound(k));
+	}
+		// [first element not less than k, first element greater than k),
+		// with one descent until a node equivalent to k splits the search
+	template <class K>
+	ft::pair<base_ptr, base_ptr>	equal_range (const K& k) const {
+		base_ptr	upper = _end();
+
+		for (base_ptr tmp = _head; tmp != nullptr; ) {
+			if (_compare(_key(_value(tmp)), k))
+				tmp = tmp->right;
+			else if (_compare(k, _key(_value(tmp)))) {
+				upper = tmp;
+				tmp = tmp->left;
+			}
+			else
+				return ft::make_pair(_lower_bound(tmp->left, tmp, k), _upper_bound(tmp->right, upper, k));
+		}
+		return ft::make_pair(upper, upper);
+	}
+		// elements equivalent to k: O(log n) with FT_TREE_ORDER_STATISTICS,
+		// O(log n + count) otherwise
+	template <class K>
+	size_type	count_equal (const K& k) const {
+		ft::pair<base_ptr, base_ptr>	range = equal_range(k);
+# ifdef FT_TREE_ORDER_STATISTICS
+		return node_index(range.second) - node_index(range.first);
+# else
+		size_type	n = 0;
+
+		for (; range.first != range.second; range.first = successor(range.first))
+			n++;
+		return n;
+# endif
+	}
+	// 7) Bulk construction of an empty tree from sorted input in O(n)
+		// a) checks that [first, last) is sorted and skips equivalent values,
+		//    returns false and leaves the tree untouched otherwise
+	template <class ForwardIt>
+	bool	build (ForwardIt first, ForwardIt last) {
+		size_type	n = 1;
+
+		if (_head != nullptr)
+			return false;
+		if (first == last)
+			return true;
+		for (ForwardIt prev = first, it = first; ++it != last; prev = it) {
+			if (_compare(_key(*it), _key(*prev)))
+				return false;
+			if (_compare(_key(*prev), _key(*it)))
+				n++;
+		}
+		_build(first, last, n, true);
+		return true;
+	}
+		//    keeping equivalent values, for multimap and multiset
+	template <class ForwardIt>
+	bool	build_equal (ForwardIt first, ForwardIt last) {
+		size_type	n = 1;
+
+		if (_head != nullptr)
+			return false;
+		if (first == last)
+			return true;
+		for (ForwardIt prev = first, it = first; ++it != last; prev = it, n++)
+			if (_compare(_key(*it), _key(*prev)))
+				return false;
+		_build(first, last, n, false);
+		return true;
+	}
+		// b) trusts the caller: [first, last) holds n strictly increasing values
+	template <class ForwardIt>
+	void	build_unique (ForwardIt first, ForwardIt last, size_type n) {
+		if (n != 0)
+			_build(first, last, n, false);
+	}
+# ifdef FT_TREE_ORDER_STATISTICS
+	// 8) Order statistics over the subtree sizes, O(log n)
+		// a) element at position k in order, end() when k >= size()
+	base_ptr	select (size_type k) const {
+		return node_select(_end(), k);
+	}
+		// b) number of elements less than k
+	template <class K>
+	size_type	rank (const K& k) const {
+		size_type	res = 0;
+
+		for (base_ptr tmp = _head; tmp != nullptr; ) {
+			if (_compare(_key(_value(tmp)), k)) {
+				res += node_count(tmp->left) + 1;
+				tmp = tmp->right;
+			}
+			else
+				tmp = tmp->left;
+		}
+		return res;
+	}
+# endif
+	// 9) Split and join, O(log n) relinking of whole subtrees (Tarjan's
+	//    black-height join); nodes change trees, nothing is copied
+		// a) moves every element not less than k into right, whose previous
+		//    elements are destroyed; right takes this tree's comparator and
+		//    allocators. The sizes of both halves are known in O(1) with
+		//    FT_TREE_ORDER_STATISTICS, otherwise the smaller one is counted
+	template <class K>
+	void	split (const K& k, tree& right) {
+		base_ptr	l;
+		base_ptr	r;
+		size_type	lbh;
+		size_type	rbh;
+		size_type	n = _size;
+
+		right.clear();
+		right._compare = _compare;
+		right._alloc = _alloc;
+		right._node_alloc = _node_alloc;
+		if (_head == nullptr)
+			return ;
+		_split(_head, _black_height(_head), k, l, lbh, r, rbh);
+		_head = nullptr;
+		_set_root(l);
+		right._set_root(r);
+		_size = n - right._count_split(*this, n);
+		right._size = n - _size;
 	}
+		// b) moves every element of right after the last one of this tree;
+		//    false, with both trees untouched, unless all keys of right are
+		//    greater than those here and the node allocators are equal
+	bool	join (tree& right) {
+		if (!(_node_alloc == right._node_alloc))
+			return false;
+		if (right._head == nullptr)
+			return true;
+		if (_head != nullptr && !_compare(_key(_value(_end()->right)), _key(_value(right.begin().base()))))
+			return false;
+		base_ptr	last = right._end()->right;
+		base_ptr	mid = right.begin().base();
+		size_type	n = _size + right._size;
+		size_type	bh;
+
+		if (right._size > 1)
+			right._rb_unlink(mid);
+		else
+			right._head = nullptr;
+		base_ptr	l = _head;
+		base_ptr	r = right._head;
+
+		_head = _join(l, _black_height(l), mid, r, _black_height(r), bh);
+		_head->set_parent(_end());
+		_end()->left = _head;
+		_end()->right = last;
+		_size = n;
+		right._head = nullptr;
+		right._end()->left = nullptr;
+		right._end()->right = nullptr;
+		right._size = 0;
+		return true;
+	}
+# ifdef FT_TREE_STATS
+	// 10) Instrumentation (FT_TREE_STATS): the shape is measured in O(n)
+	//     on each call, the counters cost one increment where they change
+	tree_stats	statistics () const {
+		tree_stats	st = _stats;
+		double		depths = 0;
+
+		_shape(_head, 1, st.height, depths);
+		st.black_height = _black_height(_head);
+		st.average_depth = _size ? depths / _size : 0;
+		return st;
+	}
+	void	reset_statistics () {
+		_stats = tree_stats();
+	}
+# endif
 	// Min/Max search functions
-	pointer	node_maximum (pointer current) const {
+	base_ptr	node_maximum (base_ptr current) const {
 		if (current == nullptr)
 			return current;
 		while (current->right != nullptr)
 			current = current->right;
 		return current;
 	}
-	pointer	node_minimum (pointer current) const {
+	base_ptr	node_minimum (base_ptr current) const {
 		if (current == nullptr)
 			return current;
 		while (current->left != nullptr)
@@ -264,82 +641,117 @@ public:
 		return current;	
 	}
 	// Predecessor/successor functions
-	pointer	successor (pointer current) const {
+	base_ptr	successor (base_ptr current) const {
 		if (current->right != nullptr)
 			return node_minimum(current->right);
-		pointer	Par = current->parent;
-		while (Par != _root && current == Par->right) {
+		base_ptr	Par = current->parent();
+		while (Par != _end() && current == Par->right) {
 			current = Par;
-			Par = Par->parent;
+			Par = Par->parent();
 		}
 		return Par;
 	}
-	pointer	predecessor (pointer current) const {
+	base_ptr	predecessor (base_ptr current) const {
 		if (current->left != nullptr)
 			return node_maximum(current->left);
-		pointer	Par = current->parent;
-		while (Par != _root && current == Par->left) {
+		base_ptr	Par = current->parent();
+		while (Par != _end() && current == Par->left) {
 			current = Par;
-			Par = Par->parent;
+			Par = Par->parent();
 		}
 		return Par;
 	}
 private:
 	//TREE MANIPULATION
 		//1)Left Rotation
-	void	rotate_left(pointer x) {
-		pointer y = x->right;
+	void	rotate_left(base_ptr x) {
+		base_ptr y = x->right;
 
 		if (y) {
 			x->right = y->left;
 			if (y->left)
-				y->left->parent = x;
+				y->left->set_parent(x);
 			y->left = x;
-			y->parent = x->parent;
-			if (x->parent != _root) {
-				if (x->parent->left == x)
-					x->parent->left = y;
+			y->set_parent(x->parent());
+			if (x->parent() != _end()) {
+				if (x->parent()->left == x)
+					x->parent()->left = y;
 				else
-					x->parent->right = y;
+					x->parent()->right = y;
 			}
 			else {
 				_head = y;
-				_root->left = _head;
+				_end()->left = _head;
 			}
-			x->parent = y;
+			x->set_parent(y);
+			_recount(x, y);
+# ifdef FT_TREE_STATS
+			_stats.rotations++;
+# endif
 		}
 	}
 		//2)Right Rotation
-	void	rotate_right(pointer x) {
-		pointer y = x->left;
+	void	rotate_right(base_ptr x) {
+		base_ptr y = x->left;
 
 		if (y) {
 			x->left = y->right;
 			if (y->right)
-				y->right->parent = x;
+				y->right->set_parent(x);
 			y->right = x;
-			y->parent = x->parent;
-			if (x->parent != _root) {
-				if (x->parent->left == x)
-					x->parent->left = y;
+			y->set_parent(x->parent());
+			if (x->parent() != _end()) {
+				if (x->parent()->left == x)
+					x->parent()->left = y;
 				else
-					x->parent->right = y;
+					x->parent()->right = y;
 			}
 			else {
 				_head = y;
-				_root->left = _head;
+				_end()->left = _head;
 			}
-			x->parent = y;
+			x->set_parent(y);
+			_recount(x, y);
+# ifdef FT_TREE_STATS
+			_stats.rotations++;
+# endif
 		}
+	}
+		//   y took the place of x above it: y now roots x's old subtree
+	void	_recount(base_ptr x, base_ptr y) {
+# ifdef FT_TREE_ORDER_STATISTICS
+		y->count = x->count;
+		x->count = node_count(x->left) + node_count(x->right) + 1;
+# else
+		(void)x;
+		(void)y;
+# endif
 	}
 		//3)Recolour
-	void	recolor_node(const node_type& x) {
-		if (x.red == true)
-			x.red = false;
-		else
-			x.red = true;
+	void	recolor_node(base_ptr x) {
+		x->set_red(!x->red());
+	}
+		//  Colouring done by the rebalancing, counted with FT_TREE_STATS
+		//  when it changes the colour
+	void	_recolor(base_ptr x, bool red) {
+# ifdef FT_TREE_STATS
+		_stats.recolors += (x->red() != red);
+# endif
+		x->set_red(red);
 	}
 	// UTILS
+		// 0) Value held by a node and its key
+	static value_type&		_value(base_ptr node) { return static_cast<pointer>(node)->value; }
+	static const key_type&	_key(const value_type& val) { return KeyOfValue()(val); }
+		//    Slot found by insert_pos/insert_hint_pos
+	static base_ptr	_slot(base_ptr node, bool side, base_ptr& parent, bool& left) {
+		parent = node;
+		left = side;
+		return nullptr;
+	}
+		//    Sentinels, usable from const members
+	base_ptr	_end() const { return const_cast<base_ptr>(&_header); }
+	base_ptr	_nil() { return &_leaf; }
 		// 1) Node Allocation
 			// a) red node allocation
 	pointer	_nallocate (const value_type& val) {
@@ -349,20 +761,77 @@ private:
 		}
 		catch(...) {
 			_node_alloc.deallocate(new_node, 1);
+			throw;
+		}
+		*static_cast<Node_base*>(new_node) = Node_base();
+		new_node->set_red(true);
+		return new_node;
+	}
+# if __cplusplus >= 201103L
+			//    value constructed in place from args
+	template <class... Args>
+	pointer	_nconstruct (Args&&... args) {
+		pointer new_node = _node_alloc.allocate(1);
+		try	{
+			_alloc.construct(&(new_node->value), std::forward<Args>(args)...);
+		}
+		catch(...) {
+			_node_alloc.deallocate(new_node, 1);
+			throw;
+		}
+		*static_cast<Node_base*>(new_node) = Node_base();
+		new_node->set_red(true);
+		return new_node;
+	}
+			//    and freed again before it was ever linked
+	void	_drop_node (pointer node) {
+		_alloc.destroy(&(node->value));
+		_node_alloc.deallocate(node, 1);
+	}
+# else
+			//    value constructed in place: a C++98 allocator can only
+			//    copy-construct, so the constructor is called directly
+	template <class A1, class A2>
+	pointer	_nconstruct (const A1& a1, const A2& a2) {
+		pointer new_node = _node_alloc.allocate(1);
+		try	{
+			::new(static_cast<void*>(&(new_node->value))) value_type(a1, a2);
+		}
+		catch(...) {
+			_node_alloc.deallocate(new_node, 1);
+			throw;
 		}
-		new_node->red = true; new_node->left = nullptr;
-		new_node->right = nullptr; new_node->parent = nullptr;
+		*static_cast<Node_base*>(new_node) = Node_base();
+		new_node->set_red(true);
 		return new_node;
 	}
-			// b) Null leaf allocation
-	pointer	_null_leaf_alloc() {
+	template <class A1, class A2, class A3>
+	pointer	_nconstruct (const A1& a1, const A2& a2, const A3& a3) {
 		pointer new_node = _node_alloc.allocate(1);
-		new_node->red = false; new_node->left = nullptr;
-		new_node->right = nullptr; new_node->parent = nullptr;
+		try	{
+			::new(static_cast<void*>(&(new_node->value))) value_type(a1, a2, a3);
+		}
+		catch(...) {
+			_node_alloc.deallocate(new_node, 1);
+			throw;
+		}
+		*static_cast<Node_base*>(new_node) = Node_base();
+		new_node->set_red(true);
 		return new_node;
 	}
+# endif
+			// b) Gives every node back at once when the allocator supports it
+			//    and this tree owns all its live nodes: O(slabs) for a pool
+	bool	_release_nodes() {
+		if (!release_all(_node_alloc, _size))
+			return false;
+		_size = 0;
+		return true;
+	}
 		// 2) Deallocate Node
-	void	_del_node (pointer pos) {
+	void	_del_node (base_ptr base) {
+		pointer	pos = static_cast<pointer>(base);
+
 		try	{
 			_alloc.destroy(&(pos->value));
 		}
@@ -372,67 +841,118 @@ private:
 		_node_alloc.deallocate(pos, 1);
 		_size--;
 	}
-		// 3) Balance Tree after Insertion
-	void	_ins_balance (pointer Kid) {
-		for (pointer Uncle = nullptr; Kid != _head && Kid->parent->red == true; ) {
-			if (Kid->parent == Kid->parent->parent->left) {
-				Uncle = Kid->parent->parent->right;
-				if (Uncle && Uncle->red == true)
+		// 3) Balance Tree after Insertion: true when recolouring reached the
+		//    root, which adds one black node to every path (join needs it)
+	bool	_ins_balance (base_ptr Kid) {
+		for (base_ptr Uncle = nullptr; Kid != _head && Kid->parent()->red() == true; ) {
+			if (Kid->parent() == Kid->parent()->parent()->left) {
+				Uncle = Kid->parent()->parent()->right;
+				if (Uncle && Uncle->red() == true)
 					Kid = _ins_balance_case1(Kid, Uncle);	
 				else {
-					if (Kid == Kid->parent->right) {
-						Kid = Kid->parent;
+					if (Kid == Kid->parent()->right) {
+						Kid = Kid->parent();
 						rotate_left(Kid);
 					}
 					_ins_balance_case3(Kid);
 				}				
 			}
 			else {
-				Uncle = Kid->parent->parent->left;
-				if (Uncle && Uncle->red == true)
+				Uncle = Kid->parent()->parent()->left;
+				if (Uncle && Uncle->red() == true)
 					Kid = _ins_balance_case1(Kid, Uncle);
 				else {
-					if (Kid == Kid->parent->left) {
-						Kid = Kid->parent;
+					if (Kid == Kid->parent()->left) {
+						Kid = Kid->parent();
 						rotate_right(Kid);
 					}
 					_ins_balance_case2(Kid);
 				}
 			}
 		}
-		_head->red = false;
+		_recolor(_head, false);
+		return Kid == _head;
+	}
+		// Links a new node as the left or right child of parent (_end() when
+		// the tree is empty) and rebalances; the caller has checked the order
+	base_ptr	_insert_at(base_ptr parent, bool left, const value_type& val) {
+		return _link_at(parent, left, _nallocate(val));
+	}
+	base_ptr	_link_at(base_ptr parent, bool left, base_ptr node) {
+		node->set_parent(parent);
+# ifdef FT_TREE_ORDER_STATISTICS
+		node->count = 1;
+		for (base_ptr par = parent; par != _end(); par = par->parent())
+			par->count++;
+# endif
+		if (parent == _end()) {
+			node->set_red(false);
+			_head = node;
+			_end()->left = node;
+			_end()->right = node;
+		}
+		else {
+			if (left)
+				parent->left = node;
+			else
+				parent->right = node;
+			if (!left && parent == _end()->right)
+				_end()->right = node;
+			_ins_balance(node);
+		}
+		_size++;
+		return node;
 	}
 	// 4) Balncing insertion cases
 		 // If Uncle is red colour -> colors to be flipped -> Uncle and Parent become black, Grandparent red
-	pointer	_ins_balance_case1(pointer Kid, pointer Uncle) {
-		Kid->parent->red = false;
-		Uncle->red = false;
-		if (Kid->parent->parent != _root)
-			Kid->parent->parent->red = true;
-		return Kid->parent->parent;
+	base_ptr	_ins_balance_case1(base_ptr Kid, base_ptr Uncle) {
+		_recolor(Kid->parent(), false);
+		_recolor(Uncle, false);
+		if (Kid->parent()->parent() != _end())
+			_recolor(Kid->parent()->parent(), true);
+		return Kid->parent()->parent();
 	}
 		 //b) Uncle is black, Parent is right child and kid is right child
-	void	_ins_balance_case2(pointer Kid) {
-		Kid->parent->red = false;
-		Kid->parent->parent->red = true;
-		rotate_left(Kid->parent->parent);
+	void	_ins_balance_case2(base_ptr Kid) {
+		_recolor(Kid->parent(), false);
+		_recolor(Kid->parent()->parent(), true);
+		rotate_left(Kid->parent()->parent());
 	}
 		 //c) Uncle is black, Parent is right child and kid is left child
-	void	_ins_balance_case3(pointer Kid) {
-		Kid->parent->red = false;
-		Kid->parent->parent->red = true;
-		rotate_right(Kid->parent->parent);
+	void	_ins_balance_case3(base_ptr Kid) {
+		_recolor(Kid->parent(), false);
+		_recolor(Kid->parent()->parent(), true);
+		rotate_right(Kid->parent()->parent());
 	}
 	// 5) Deleting Node from tree
-	void	_rb_deletion(pointer z) {
-		bool	is_red = z->red;
-		pointer x;
-		pointer y = z;
+	void	_rb_deletion(base_ptr z) {
+		_rb_unlink(z);
+		_del_node(z);
+	}
+		//    Takes z out of the tree without freeing it (join reuses it)
+	void	_rb_unlink(base_ptr z) {
+		bool	is_red = z->red();
+		base_ptr x;
+		base_ptr y = z;
+
+# ifdef FT_TREE_ORDER_STATISTICS
+		// the node unlinked from its place is z, or its predecessor when z
+		// has two children: every subtree above that place loses one node
+		y = (z->left != nullptr && z->right != nullptr) ? node_maximum(z->left) : z;
+		for (base_ptr par = y->parent(); par != _end(); par = par->parent())
+			par->count--;
+		y = z;
+# endif
+		if (z == _end()->right) {
+			y = predecessor(z);
+			_end()->right = (y == _end()) ? nullptr : y;
+			y = z;
+		}
 
 		if (z->left == nullptr) {
 			if (z->right == nullptr && is_red == false) {
-				z->right = _nil;
-				z->right->parent = z;
+				z->right = _nil();
+				z->right->set_parent(z);
 			}
 			x = z->right;
 			_del_changenodes(z, z->right);
@@ -443,119 +963,373 @@ private:
 		}
 		else {
 			y = node_maximum(z->left);
-			is_red = y->red;
+			is_red = y->red();
 			if (y->left == nullptr && is_red == false) {
-				y->left = _nil;
-				y->left->parent = y;
+				y->left = _nil();
+				y->left->set_parent(y);
 			}
 			x = y->left;
-			if (y->parent == z) {
-				x->parent = y;
+			if (y->parent() == z) {
+				if (x)
+					x->set_parent(y);
 			}
 			else {
 				_del_changenodes(y, y->left);
 				y->left = z->left;
-				y->left->parent = y;
+				y->left->set_parent(y);
 			}
 			_del_changenodes(z, y);
 			y->right = z->right;
-			y->right->parent = y;
-			y->red = z->red;
+			y->right->set_parent(y);
+			y->set_red(z->red());
+# ifdef FT_TREE_ORDER_STATISTICS
+			y->count = z->count;
+# endif
 		}		
-		_del_node(z);
 		if (is_red == false)
 			_del_rebalance(x);
 		_remove_nill_leaf();
 	}
 		 // a) Rebalancing tree after deletion
-	void _del_rebalance(pointer x) {
-		for (pointer s = nullptr; x != _head && x->red == false;) {
-			if (x == x->parent->left) {
-				s = x->parent->right;
-				if (s->red == true) {
-					s->red = false;
-					x->parent->red = true;
-					rotate_left(x->parent);
-					s = x->parent->right;
+	void _del_rebalance(base_ptr x) {
+		for (base_ptr s = nullptr; x != _head && x->red() == false;) {
+# ifdef FT_TREE_STATS
+			_stats.del_rebalance_loops++;
+# endif
+			if (x == x->parent()->left) {
+				s = x->parent()->right;
+				if (s->red() == true) {
+					_recolor(s, false);
+					_recolor(x->parent(), true);
+					rotate_left(x->parent());
+					s = x->parent()->right;
 				}
-				if ((s->left == nullptr || s->left->red == false) && (s->right == nullptr || s->right->red == false)) {
-					s->red = true;
-					x = x->parent;
+				if ((s->left == nullptr || s->left->red() == false) && (s->right == nullptr || s->right->red() == false)) {
+					_recolor(s, true);
+					x = x->parent();
 				}
 				else {
-					if (s->right == nullptr || s->right->red == false) {
-						s->left->red = false;
-						s->red = true;
+					if (s->right == nullptr || s->right->red() == false) {
+						_recolor(s->left, false);
+						_recolor(s, true);
 						rotate_right(s);
-						s = x->parent->right;
+						s = x->parent()->right;
 					}
-					s->red = x->parent->red;
-					s->parent->red = false;
-					s->right->red = false;
-					rotate_left(x->parent);
+					_recolor(s, x->parent()->red());
+					_recolor(s->parent(), false);
+					_recolor(s->right, false);
+					rotate_left(x->parent());
 					x = _head;
 				}
 			}
 			else {
-				s = x->parent->left;
-				if (s->red == true) {
-					s->red = false;
-					x->parent->red = true;
-					rotate_right(x->parent);
-					s = x->parent->left;
+				s = x->parent()->left;
+				if (s->red() == true) {
+					_recolor(s, false);
+					_recolor(x->parent(), true);
+					rotate_right(x->parent());
+					s = x->parent()->left;
 				}
-				if ((s->left == nullptr || s->left->red == false) && (s->right == nullptr || s->right->red == false)) {
-					s->red = true;
-					x = x->parent;
+				if ((s->left == nullptr || s->left->red() == false) && (s->right == nullptr || s->right->red() == false)) {
+					_recolor(s, true);
+					x = x->parent();
 				}
 				else {
-					if (s->left == nullptr || s->left->red == false) {
-						s->right->red = false;
-						s->red = true;
+					if (s->left == nullptr || s->left->red() == false) {
+						_recolor(s->right, false);
+						_recolor(s, true);
 						rotate_left(s);
-						s = x->parent->left;
+						s = x->parent()->left;
 					}
-					s->red = x->parent->red;
-					x->parent->red = false;
-					s->left->red = false;
-					rotate_right(x->parent);
+					_recolor(s, x->parent()->red());
+					_recolor(x->parent(), false);
+					_recolor(s->left, false);
+					rotate_right(x->parent());
 					x = _head;
 				}
 			}
 		}
-		x->red = false;
+		_recolor(x, false);
 	}
 	// Replaces node 'pos' with a node 'other_pos'
-	void _del_changenodes(pointer pos, pointer other_pos) {
-		if (pos->parent == _root) {
+	void _del_changenodes(base_ptr pos, base_ptr other_pos) {
+		if (pos->parent() == _end()) {
 			_head = other_pos;
-			_root->left = _head;
+			_end()->left = _head;
 		}
-		else if (pos == pos->parent->left)
-			pos->parent->left = other_pos;
+		else if (pos == pos->parent()->left)
+			pos->parent()->left = other_pos;
 		else
-			pos->parent->right = other_pos;
+			pos->parent()->right = other_pos;
 		if (other_pos)
-			other_pos->parent = pos->parent;
+			other_pos->set_parent(pos->parent());
 	}
 
 	void _remove_nill_leaf() {
-		if (_nil->parent) {
-			if (_nil->parent->left == _nil)
-				_nil->parent->left = nullptr;
+		if (_nil()->parent()) {
+			if (_nil()->parent()->left == _nil())
+				_nil()->parent()->left = nullptr;
 			else
-				_nil->parent->right =nullptr;
-			_nil->parent = nullptr;
+				_nil()->parent()->right =nullptr;
+			_nil()->set_parent(nullptr);
 		}
-		if (_head == _nil)
+		if (_head == _nil())
 			_head = nullptr;
 	}
-	void	_copy_tree(pointer other_head) {
-		if (other_head == nullptr)
+	// Bounds search: keeps the last node where the descent turned left
+	template <class K>
+	base_ptr	_lower_bound (const K& k) const {
+		return _lower_bound(_head, _end(), k);
+	}
+		//    in the subtree under tmp, result when all of it is less
+	template <class K>
+	base_ptr	_lower_bound (base_ptr tmp, base_ptr result, const K& k) const {
+		while (tmp != nullptr) {
+			if (!_compare(_key(_value(tmp)), k)) {
+				result = tmp;
+				tmp = tmp->left;
+			}
+			else
+				tmp = tmp->right;
+		}
+		return result;
+	}
+	template <class K>
+	base_ptr	_upper_bound (const K& k) const {
+		return _upper_bound(_head, _end(), k);
+	}
+		//    in the subtree under tmp, result when all of it is not greater
+	template <class K>
+	base_ptr	_upper_bound (base_ptr tmp, base_ptr result, const K& k) const {
+		while (tmp != nullptr) {
+			if (_compare(k, _key(_value(tmp)))) {
+				result = tmp;
+				tmp = tmp->left;
+			}
+			else
+				tmp = tmp->right;
+		}
+		return result;
+	}
+	// Sorted build: the middle value becomes the root of each subtree, so
+	// every level but the deepest is full; nodes on that last, partial
+	// level are red and all paths keep the same black height
+	template <class ForwardIt>
+	void	_build(ForwardIt first, ForwardIt last, size_type n, bool skip_equal) {
+		size_type	black = 1;
+
+		while ((size_type(2) << black) - 1 <= n)
+			black++;
+		_head = _build_subtree(first, last, n, 0, black, skip_equal);
+		_head->set_parent(_end());
+		_end()->left = _head;
+		_end()->right = node_maximum(_head);
+	}
+	template <class ForwardIt>
+	base_ptr	_build_subtree(ForwardIt& it, ForwardIt last, size_type n,
+							size_type depth, size_type black, bool skip_equal) {
+		if (n == 0)
+			return nullptr;
+		base_ptr	left = _build_subtree(it, last, n / 2, depth + 1, black, skip_equal);
+		base_ptr	node = nullptr;
+
+		try {
+			node = _nallocate(*it);
+		}
+		catch (...) {
+			_clear(left);
+			throw;
+		}
+		_size++;
+		node->set_red((depth >= black));
+# ifdef FT_TREE_ORDER_STATISTICS
+		node->count = n;
+# endif
+		node->left = left;
+		if (left)
+			left->set_parent(node);
+		for (++it; skip_equal && it != last && !_compare(_key(_value(node)), _key(*it)); ++it) ;
+		try {
+			node->right = _build_subtree(it, last, n - n / 2 - 1, depth + 1, black, skip_equal);
+		}
+		catch (...) {
+			_clear(node);
+			throw;
+		}
+		if (node->right)
+			node->right->set_parent(node);
+		return node;
+	}
+	// Split and join helpers, on subtrees detached from the header; black
+	// heights count the black nodes on any path down from a subtree's root
+	size_type	_black_height(base_ptr node) const {
+		size_type	bh = 0;
+
+		for (; node != nullptr; node = node->left)
+			bh += !node->red();
+		return bh;
+	}
+# ifdef FT_TREE_STATS
+		//    Height and sum of the depths of the subtree at node, found at depth
+	void	_shape(base_ptr node, size_type depth, size_type& height, double& depths) const {
+		if (node == nullptr)
+			return ;
+		if (depth > height)
+			height = depth;
+		depths += depth;
+		_shape(node->left, depth + 1, height, depths);
+		_shape(node->right, depth + 1, height, depths);
+	}
+# endif
+		//    Roots the tree at node after a split
+	void	_set_root(base_ptr node) {
+		_head = node;
+		_end()->left = node;
+		_end()->right = node_maximum(node);
+		if (node != nullptr)
+			node->set_parent(_end());
+	}
+		//    Elements of this tree, right half of a split of n elements,
+		//    counted from whichever end of the two halves runs out first
+	size_type	_count_split(const tree& left, size_type n) const {
+# ifdef FT_TREE_ORDER_STATISTICS
+		(void)left;
+		(void)n;
+		return node_count(_head);
+# else
+		base_ptr	a = left.node_maximum(left._head);
+		base_ptr	b = node_minimum(_head);
+		size_type	steps = 0;
+
+		for (; a != nullptr && b != nullptr; steps++) {
+			if (a == left._end())
+				return n - steps;
+			if (b == _end())
+				return steps;
+			a = left.predecessor(a);
+			b = successor(b);
+		}
+		return a == nullptr ? n : 0;
+# endif
+	}
+		//    Splits the subtree under node, of black height bh, into the
+		//    values less than k and the others
+	template <class K>
+	void	_split(base_ptr node, size_type bh, const K& k,
+					base_ptr& l, size_type& lbh, base_ptr& r, size_type& rbh) {
+		base_ptr	m;
+		size_type	mbh;
+
+		if (node == nullptr) {
+			l = nullptr;
+			r = nullptr;
+			lbh = 0;
+			rbh = 0;
 			return ;
-		insert(other_head->value);
-		_copy_tree(other_head->left);
-		_copy_tree(other_head->right);
+		}
+		base_ptr	left = node->left;
+		base_ptr	right = node->right;
+		size_type	cbh = bh - !node->red();
+
+		if (!_compare(_key(_value(node)), k)) {
+			_split(left, cbh, k, l, lbh, m, mbh);
+			r = _join(m, mbh, node, right, cbh, rbh);
+		}
+		else {
+			_split(right, cbh, k, m, mbh, r, rbh);
+			l = _join(left, cbh, node, m, mbh, lbh);
+		}
+	}
+		//    Joins l < mid < r into one subtree and returns its root, of black
+		//    height bh: mid goes down the spine of the higher subtree to a
+		//    black node as high as the other one, then insertion rebalancing
+		//    runs from there, with the higher subtree briefly as _head
+	base_ptr	_join(base_ptr l, size_type lbh, base_ptr mid, base_ptr r, size_type rbh, size_type& bh) {
+		if (l != nullptr && l->red()) {
+			l->set_red(false);
+			lbh++;
+		}
+		if (r != nullptr && r->red()) {
+			r->set_red(false);
+			rbh++;
+		}
+		if (lbh == rbh) {
+			_link_children(mid, l, r);
+			mid->set_red(false);
+			bh = lbh + 1;
+			return mid;
+		}
+		bool		spine_right = lbh > rbh;
+		base_ptr	top = spine_right ? l : r;
+		base_ptr	c = top;
+		base_ptr	parent = nullptr;
+
+		bh = spine_right ? lbh : rbh;
+		for (size_type cbh = bh; c != nullptr && (c->red() || cbh > (spine_right ? rbh : lbh)); ) {
+			cbh -= !c->red();
+			parent = c;
+			c = spine_right ? c->right : c->left;
+		}
+		if (spine_right) {
+			_link_children(mid, c, r);
+			parent->right = mid;
+		}
+		else {
+			_link_children(mid, l, c);
+			parent->left = mid;
+		}
+		mid->set_parent(parent);
+		mid->set_red(true);
+# ifdef FT_TREE_ORDER_STATISTICS
+		for (base_ptr par = parent; par != nullptr; par = (par == top) ? nullptr : par->parent())
+			par->count = node_count(par->left) + node_count(par->right) + 1;
+# endif
+		_head = top;
+		_end()->left = top;
+		top->set_parent(_end());
+		bh += _ins_balance(mid);
+		top = _head;
+		_head = nullptr;
+		return top;
+	}
+	void	_link_children(base_ptr node, base_ptr left, base_ptr right) {
+		node->left = left;
+		node->right = right;
+		if (left != nullptr)
+			left->set_parent(node);
+		if (right != nullptr)
+			right->set_parent(node);
+# ifdef FT_TREE_ORDER_STATISTICS
+		node->count = node_count(left) + node_count(right) + 1;
+# endif
+	}
+	// Structural copy: clones shape and colours of another tree in O(n),
+	// without comparisons or rebalancing
+	void	_copy_tree(base_ptr other_head) {
+		_head = _clone(other_head, _end());
+		_end()->left = _head;
+		_end()->right = node_maximum(_head);
+	}
+	base_ptr	_clone(base_ptr src, base_ptr parent) {
+		if (src == nullptr)
+			return nullptr;
+		base_ptr	node = _nallocate(_value(src));
+
+		node->set_red(src->red());
+		node->set_parent(parent);
+# ifdef FT_TREE_ORDER_STATISTICS
+		node->count = src->count;
+# endif
+		_size++;
+		try {
+			node->left = _clone(src->left, node);
+			node->right = _clone(src->right, node);
+		}
+		catch (...) {
+			_clear(node);
+			throw;
+		}
+		return node;
 	}
 };
 
@@ -6,7 +6,7 @@
 /*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/08 16:03:32 by doreshev          #+#    #+#             */
-/*   Updated: 2022/11/14 11:33:02 by doreshev         ###   ########.fr       */
+/*   Updated: 2026/10/18 08:42:58 by doreshev         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -49,13 +49,14 @@ public:
 		}
 	};
 
-	typedef	ft::tree<value_type, value_compare, allocator_type>		tree;
+	typedef	ft::tree<key_type, value_type, ft::select_first<value_type>, key_compare, allocator_type>	tree;
 	typedef	typename tree::iterator									iterator;
 	typedef	typename tree::const_iterator							const_iterator;
 	typedef	typename tree::reverse_iterator							reverse_iterator;
 	typedef	typename tree::const_reverse_iterator					const_reverse_iterator;
 
 private:
+	typedef	typename tree::base_ptr									base_ptr;
 	key_compare				_comp;
 	allocator_type			_alloc;
 	tree					_tree;
@@ -65,21 +66,26 @@ public:
 	// CONSTRUCTORS
 		// 1) Empty
 	explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
-				: _comp(comp), _alloc(alloc), _tree(value_compare(comp), alloc) { }
+				: _comp(comp), _alloc(alloc), _tree(comp, alloc) { }
 		// 2) Range
 	template <class InputIterator>
 	map (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
-		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _tree(value_compare(comp), alloc) {
-		insert(first, last);
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _tree(comp, alloc) {
+		_range_init(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+	}
+		// 3) Range already sorted by comp without equivalent keys
+	template <class InputIterator>
+	map (ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _tree(comp, alloc) {
+		_sorted_init(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 	}
-		// 3) Copy
+		// 4) Copy
 	map (const map& x) : _comp(x.key_comp()), _alloc(x.get_allocator()), _tree(x._tree) { }
 	// DESTRUCTOR
 	~map () { }
 	// ASSIGN OPERATOR
 		//assigns values to the container
 	map& operator= (const map& x) {
-		_alloc = x.get_allocator();
 		_comp = x.key_comp();
 		_tree = x._tree;
 		return *this;
@@ -90,20 +96,21 @@ public:
 // ELEMENT ACCESS
 	// AT -> access specified element with bounds checking
 	mapped_type& at (const key_type& k) {
-		Node<value_type>* tmp = _tree.find(ft::make_pair(k, mapped_type()));
+		Node<value_type>* tmp = _tree.find(k);
 		if (tmp == nullptr)
 			throw std::out_of_range("ft::map::at");
 		return (tmp->value.second);
 	}
 	const mapped_type& at (const key_type& k) const {
-		Node<value_type>* tmp = _tree.find(ft::make_pair(k, mapped_type()));
+		Node<value_type>* tmp = _tree.find(k);
 		if (tmp == nullptr)
 			throw std::out_of_range("ft::map::at");
 		return (tmp->value.second);
 	}
 	// [] -> access or insert specified element
+		// mapped_type is only default-constructed when k is missing
 	mapped_type& operator[] (const key_type& k) {
-		return (insert(ft::make_pair(k, mapped_type())).first)->second;
+		return try_emplace(k).first->second;
 	}
 // ITERATORS
 	// 1) begin -> returns an iterator to the beginning
@@ -146,8 +153,7 @@ public:
 	pair<iterator,bool> insert (const value_type& val) { return _tree.insert(val); }
 		// b) With hint 
 	iterator insert (iterator position, const value_type& val) {
-		(void)position;
-		return _tree.insert(val).first;
+		return _tree.insert(position, val);
 	}
 		// c) Range
 	template <class InputIterator>
@@ -155,28 +161,153 @@ public:
 		for (; first != last; first++)
 			insert(*first);
 	}
+		// d) Inserts k only when it is missing: once the key lookup failed
+		//    the node's second is direct-initialized from args (no mapped_type
+		//    temporary), nothing is constructed when k is already there
+# if __cplusplus >= 201103L
+	template <class... Args>
+	pair<iterator,bool> try_emplace (const key_type& k, Args&&... args) {
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = _tree.insert_pos(k, parent, left);
+
+		if (found != nullptr)
+			return ft::make_pair(iterator(found), false);
+		return ft::make_pair(_tree.emplace_at(parent, left, ft::emplace_second, k, std::forward<Args>(args)...), true);
+	}
+	template <class... Args>
+	iterator try_emplace (iterator hint, const key_type& k, Args&&... args) {
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = _tree.insert_hint_pos(hint, k, parent, left);
+
+		if (found != nullptr)
+			return iterator(found);
+		return _tree.emplace_at(parent, left, ft::emplace_second, k, std::forward<Args>(args)...);
+	}
+# else
+	pair<iterator,bool> try_emplace (const key_type& k) {
+		return _try_insert(k, nullptr);
+	}
+	pair<iterator,bool> try_emplace (const key_type& k, const mapped_type& obj) {
+		return _try_insert(k, &obj);
+	}
+	iterator try_emplace (iterator hint, const key_type& k) {
+		return _try_insert(hint, k, nullptr);
+	}
+	iterator try_emplace (iterator hint, const key_type& k, const mapped_type& obj) {
+		return _try_insert(hint, k, &obj);
+	}
+# endif
+		// e) Assigns obj to the element with key k, inserts it when missing
+# if __cplusplus >= 201103L
+	template <class M>
+	pair<iterator,bool> insert_or_assign (const key_type& k, M&& obj) {
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = _tree.insert_pos(k, parent, left);
+
+		if (found != nullptr) {
+			iterator	it(found);
+
+			it->second = std::forward<M>(obj);
+			return ft::make_pair(it, false);
+		}
+		return ft::make_pair(_tree.emplace_at(parent, left, k, std::forward<M>(obj)), true);
+	}
+	template <class M>
+	iterator insert_or_assign (iterator hint, const key_type& k, M&& obj) {
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = _tree.insert_hint_pos(hint, k, parent, left);
+
+		if (found != nullptr) {
+			iterator	it(found);
+
+			it->second = std::forward<M>(obj);
+			return it;
+		}
+		return _tree.emplace_at(parent, left, k, std::forward<M>(obj));
+	}
+		// f) Builds the element from args, keeps it only if its key is new
+	template <class... Args>
+	pair<iterator,bool> emplace (Args&&... args) {
+		return _tree.emplace_unique(std::forward<Args>(args)...);
+	}
+	template <class... Args>
+	iterator emplace_hint (iterator hint, Args&&... args) {
+		return _tree.emplace_hint_unique(hint, std::forward<Args>(args)...);
+	}
+# else
+	pair<iterator,bool> insert_or_assign (const key_type& k, const mapped_type& obj) {
+		pair<iterator,bool>	res = try_emplace(k, obj);
+
+		if (!res.second)
+			res.first->second = obj;
+		return res;
+	}
+	iterator insert_or_assign (iterator hint, const key_type& k, const mapped_type& obj) {
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = _tree.insert_hint_pos(hint, k, parent, left);
+
+		if (found == nullptr)
+			return _insert_new(parent, left, k, &obj);
+		iterator	it(found);
+
+		it->second = obj;
+		return it;
+	}
+# endif
 	// 3) Erase -> Removes from container elements
 		// a) Removes element in given position
 	void erase (iterator position) { _tree.erase(position.base()); }
 		// b) Removes element with given key
-	size_type erase (const key_type& k) { return _tree.erase(ft::make_pair(k, mapped_type())); }
+	size_type erase (const key_type& k) { return _tree.erase(k); }
 		// c) Removes elemets in given range
 	void erase (iterator first, iterator last) {
-		while (first != last)
-			erase(first++);
+		_tree.erase(first.base(), last.base());
 	}
 	// 4) Swap -> Exchanges the content of the container by the content of x
 	void swap (map& x) {
 		_tree.swap(x._tree);
 	}
+	// 5) Split -> moves the elements not less than k into right, replacing
+	//    its content, in O(log n) (see tree::split)
+	void split (const key_type& k, map& right) {
+		if (&right == this)
+			return ;
+		_tree.split(k, right._tree);
+		right._comp = _comp;
+		right._alloc = _alloc;
+	}
+	// 6) Join -> moves every element of right to the end of this map: O(log n)
+	//    when all its keys are greater than those here and the allocators are
+	//    equal, otherwise they are inserted one at a time and the keys already
+	//    here keep their values
+	void join (map& right) {
+		if (&right == this || _tree.join(right._tree))
+			return ;
+		insert(right.begin(), right.end());
+		right.clear();
+	}
 // LOOKUP (Operations)
+	//    Every lookup also has a template overload taking any K the comparator
+	//    accepts, enabled when key_compare is transparent (e.g. ft::less<>)
 	// 1) Count -> Count elements with a specific key
-	size_type count (const key_type& k) const {
-		return _tree.count(ft::make_pair(k, mapped_type()));
-	}
+	size_type count (const key_type& k) const { return _tree.count(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type
+		count (const K& k) const { return _tree.count(k); }
 	// 2) Find -> finds element with specific key
-	iterator find (const key_type& k) { return iterator(_tree.iter_find(ft::make_pair(k, mapped_type()))); }
-	const_iterator find (const key_type& k) const { return const_iterator(_tree.iter_find(ft::make_pair(k, mapped_type()))); }
+	iterator find (const key_type& k) { return iterator(_tree.iter_find(k)); }
+	const_iterator find (const key_type& k) const { return const_iterator(_tree.iter_find(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		find (const K& k) { return iterator(_tree.iter_find(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		find (const K& k) const { return const_iterator(_tree.iter_find(k)); }
 	// 3) Get range of equal elements
 	pair<const_iterator,const_iterator> equal_range (const key_type& k) const {
 		return ft::make_pair(lower_bound(k), upper_bound(k));
@@ -184,16 +315,101 @@ public:
 	pair<iterator,iterator> equal_range (const key_type& k) {
 		return ft::make_pair(lower_bound(k), upper_bound(k));
 	}
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<const_iterator,const_iterator> >::type
+		equal_range (const K& k) const { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<iterator,iterator> >::type
+		equal_range (const K& k) { return ft::make_pair(lower_bound(k), upper_bound(k)); }
 	// 4) Return iterator to lower bound
-	iterator lower_bound (const key_type& k) { return _tree.lower_bound(ft::make_pair(k, mapped_type())); }
-	const_iterator lower_bound (const key_type& k) const { return _tree.lower_bound(ft::make_pair(k, mapped_type())); }
+	iterator lower_bound (const key_type& k) { return _tree.lower_bound(k); }
+	const_iterator lower_bound (const key_type& k) const { return _tree.lower_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		lower_bound (const K& k) { return _tree.lower_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		lower_bound (const K& k) const { return _tree.lower_bound(k); }
 	// 5) Return iterator to upper bound
-	iterator upper_bound (const key_type& k) { return _tree.upper_bound(ft::make_pair(k, mapped_type())); }
-	const_iterator upper_bound (const key_type& k) const { return _tree.upper_bound(ft::make_pair(k, mapped_type())); }
+	iterator upper_bound (const key_type& k) { return _tree.upper_bound(k); }
+	const_iterator upper_bound (const key_type& k) const { return _tree.upper_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		upper_bound (const K& k) { return _tree.upper_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		upper_bound (const K& k) const { return _tree.upper_bound(k); }
+# ifdef FT_TREE_ORDER_STATISTICS
+// ORDER STATISTICS (FT_TREE_ORDER_STATISTICS), O(log n)
+	// 1) Nth -> element at position k in key order, end() when k >= size()
+	iterator nth (size_type k) { return iterator(_tree.select(k)); }
+	const_iterator nth (size_type k) const { return const_iterator(_tree.select(k)); }
+	// 2) Rank -> number of keys less than k
+	size_type rank (const key_type& k) const { return _tree.rank(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type
+		rank (const K& k) const { return _tree.rank(k); }
+# endif
+# ifdef FT_TREE_STATS
+// TREE STATISTICS (FT_TREE_STATS)
+	// 1) Height, black height and average depth, measured in O(n), with the
+	//    rotations, recolours and erase fix-up loops since the last reset
+	ft::tree_stats tree_statistics () const { return _tree.statistics(); }
+	// 2) Restarts the counters
+	void reset_tree_statistics () { _tree.reset_statistics(); }
+# endif
 // OBSERVERS
 	// Returns the function that compares keys
 	key_compare key_comp() const { return _comp; }
 	value_compare value_comp() const { return value_compare(_comp); }
+private:
+# if __cplusplus < 201103L
+	// try_emplace without variadic templates: the element is (k, *obj),
+	// or (k, mapped_type()) when obj is null, and only built once k
+	// turned out to be missing
+	pair<iterator,bool> _try_insert (const key_type& k, const mapped_type* obj) {
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = _tree.insert_pos(k, parent, left);
+
+		if (found != nullptr)
+			return ft::make_pair(iterator(found), false);
+		return ft::make_pair(_insert_new(parent, left, k, obj), true);
+	}
+	iterator _try_insert (iterator hint, const key_type& k, const mapped_type* obj) {
+		base_ptr	parent;
+		bool		left;
+		base_ptr	found = _tree.insert_hint_pos(hint, k, parent, left);
+
+		if (found != nullptr)
+			return iterator(found);
+		return _insert_new(parent, left, k, obj);
+	}
+	iterator _insert_new (base_ptr parent, bool left, const key_type& k, const mapped_type* obj) {
+		if (obj != nullptr)
+			return _tree.emplace_at(parent, left, ft::emplace_second, k, *obj);
+		return _tree.emplace_at(parent, left, ft::emplace_second, k);
+	}
+# endif
+	// Sorted forward ranges are built in a single O(n) pass,
+	// anything else falls back to one insertion per element
+	template <class ForwardIt>
+	void _range_init (ForwardIt first, ForwardIt last, ft::forward_iterator_tag) {
+		if (!_tree.build(first, last))
+			insert(first, last);
+	}
+	template <class InputIt>
+	void _range_init (InputIt first, InputIt last, ft::input_iterator_tag) {
+		insert(first, last);
+	}
+	template <class ForwardIt>
+	void _sorted_init (ForwardIt first, ForwardIt last, ft::forward_iterator_tag) {
+		_tree.build_unique(first, last, ft::distance(first, last));
+	}
+	template <class InputIt>
+	void _sorted_init (InputIt first, InputIt last, ft::input_iterator_tag) {
+		insert(first, last);
+	}
 };
 
 // RELATIONAL OPERATORS MAP
@@ -0,0 +1,284 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multimap.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:41:35 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 08:14:19 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MULTIMAP_HPP
+# define MULTIMAP_HPP
+
+# include "iterators/tree.hpp"
+
+namespace ft {
+// ft::map allowing equivalent keys: elements with equal keys keep their
+// insertion order, as with the std tree
+template<class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+class multimap {
+public:
+	typedef	Key															key_type;
+	typedef	T															mapped_type;
+	typedef	Compare														key_compare;
+	typedef	typename ft::pair<const Key, T>								value_type;
+	typedef	Allocator													allocator_type;
+	typedef	typename allocator_type::reference							reference;
+	typedef	typename allocator_type::const_reference					const_reference;
+	typedef	typename allocator_type::pointer							pointer;
+	typedef	typename allocator_type::const_pointer						const_pointer;
+	typedef	typename allocator_type::size_type							size_type;
+	typedef typename allocator_type::difference_type					difference_type;
+
+	class value_compare
+	{
+	private:
+		friend class multimap;
+	protected:
+		Compare				comp;
+		value_compare	(Compare c) : comp(c) {}
+	public:
+		typedef bool		result_type;
+		typedef value_type	first_argument_type;
+		typedef value_type	second_argument_type;
+
+		bool	operator() (const value_type& x, const value_type& y) const {
+			return comp(x.first, y.first);
+		}
+	};
+
+	typedef	ft::tree<key_type, value_type, ft::select_first<value_type>, key_compare, allocator_type>	tree;
+	typedef	typename tree::iterator									iterator;
+	typedef	typename tree::const_iterator							const_iterator;
+	typedef	typename tree::reverse_iterator							reverse_iterator;
+	typedef	typename tree::const_reverse_iterator					const_reverse_iterator;
+
+private:
+	typedef	typename tree::base_ptr									base_ptr;
+	key_compare				_comp;
+	allocator_type			_alloc;
+	tree					_tree;
+
+public:
+// MEMBER FUNCTIONS
+	// CONSTRUCTORS
+		// 1) Empty
+	explicit multimap (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+				: _comp(comp), _alloc(alloc), _tree(comp, alloc) { }
+		// 2) Range
+	template <class InputIterator>
+	multimap (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _tree(comp, alloc) {
+		_range_init(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+	}
+		// 3) Copy
+	multimap (const multimap& x) : _comp(x.key_comp()), _alloc(x.get_allocator()), _tree(x._tree) { }
+	// DESTRUCTOR
+	~multimap () { }
+	// ASSIGN OPERATOR
+		//assigns values to the container
+	multimap& operator= (const multimap& x) {
+		_comp = x.key_comp();
+		_tree = x._tree;
+		return *this;
+	}
+	// ALLOCATOR GETTER -> Returns allocator
+	allocator_type get_allocator() const { return _alloc; }
+
+// ITERATORS
+	// 1) begin -> returns an iterator to the beginning
+	iterator begin() {
+		return _tree.begin();
+	}
+	const_iterator begin() const {
+		return _tree.begin();
+	}
+	iterator end() {
+		return _tree.end();
+	}
+	const_iterator end() const {
+		return _tree.end();
+	}
+	reverse_iterator rbegin() {
+		return reverse_iterator(_tree.end());
+	}
+	const_reverse_iterator rbegin() const {
+		return const_reverse_iterator(_tree.end());
+	}
+	reverse_iterator rend() {
+		return reverse_iterator(_tree.begin());
+	}
+	const_reverse_iterator rend() const {
+		return const_reverse_iterator(_tree.begin());
+	}
+// CAPACITY
+	// 1) empty -> checks whether the container is empty
+	bool empty() const { return _tree.empty(); }
+	// 2) size -> Return container size
+	size_type size() const { return _tree.size(); }
+	// 3) maxsize -> Return container maximum size possible on current architecture
+	size_type max_size() const { return _tree.max_size(); }
+// MODIFIERS
+	// 1) Removes all elements from the multimap
+	void clear() { _tree.clear(); }
+	// 2) Insertion of elements
+		// a) Single element, after the elements with an equivalent key
+	iterator insert (const value_type& val) { return _tree.insert_equal(val); }
+		// b) With hint: as close before position as the order allows
+	iterator insert (iterator position, const value_type& val) {
+		return _tree.insert_equal(position, val);
+	}
+		// c) Range
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last) {
+		for (; first != last; first++)
+			_tree.insert_equal(end(), *first);
+	}
+	// 3) Erase -> Removes from container elements
+		// a) Removes element in given position
+	void erase (iterator position) { _tree.erase(position.base()); }
+		// b) Removes every element with given key
+	size_type erase (const key_type& k) { return _tree.erase_equal(k); }
+		// c) Removes elemets in given range
+	void erase (iterator first, iterator last) {
+		_tree.erase(first.base(), last.base());
+	}
+	// 4) Swap -> Exchanges the content of the container by the content of x
+	void swap (multimap& x) {
+		_tree.swap(x._tree);
+	}
+// LOOKUP (Operations)
+	//    Every lookup also has a template overload taking any K the comparator
+	//    accepts, enabled when key_compare is transparent (e.g. ft::less<>)
+	// 1) Count -> Count elements with a specific key, O(log n) with
+	//    FT_TREE_ORDER_STATISTICS, else O(log n) plus the count
+	size_type count (const key_type& k) const { return _tree.count_equal(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type
+		count (const K& k) const { return _tree.count_equal(k); }
+	// 2) Find -> first element with specific key
+	iterator find (const key_type& k) { return iterator(_tree.find_first(k)); }
+	const_iterator find (const key_type& k) const { return const_iterator(_tree.find_first(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		find (const K& k) { return iterator(_tree.find_first(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		find (const K& k) const { return const_iterator(_tree.find_first(k)); }
+	// 3) Get range of equal elements, in one descent
+	pair<iterator,iterator> equal_range (const key_type& k) {
+		ft::pair<base_ptr, base_ptr>	range = _tree.equal_range(k);
+
+		return ft::make_pair(iterator(range.first), iterator(range.second));
+	}
+	pair<const_iterator,const_iterator> equal_range (const key_type& k) const {
+		ft::pair<base_ptr, base_ptr>	range = _tree.equal_range(k);
+
+		return ft::make_pair(const_iterator(range.first), const_iterator(range.second));
+	}
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<iterator,iterator> >::type
+		equal_range (const K& k) {
+		ft::pair<base_ptr, base_ptr>	range = _tree.equal_range(k);
+
+		return ft::make_pair(iterator(range.first), iterator(range.second));
+	}
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<const_iterator,const_iterator> >::type
+		equal_range (const K& k) const {
+		ft::pair<base_ptr, base_ptr>	range = _tree.equal_range(k);
+
+		return ft::make_pair(const_iterator(range.first), const_iterator(range.second));
+	}
+	// 4) Return iterator to lower bound
+	iterator lower_bound (const key_type& k) { return _tree.lower_bound(k); }
+	const_iterator lower_bound (const key_type& k) const { return _tree.lower_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		lower_bound (const K& k) { return _tree.lower_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		lower_bound (const K& k) const { return _tree.lower_bound(k); }
+	// 5) Return iterator to upper bound
+	iterator upper_bound (const key_type& k) { return _tree.upper_bound(k); }
+	const_iterator upper_bound (const key_type& k) const { return _tree.upper_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		upper_bound (const K& k) { return _tree.upper_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		upper_bound (const K& k) const { return _tree.upper_bound(k); }
+# ifdef FT_TREE_ORDER_STATISTICS
+// ORDER STATISTICS (FT_TREE_ORDER_STATISTICS), O(log n)
+	// 1) Nth -> element at position k in key order, end() when k >= size()
+	iterator nth (size_type k) { return iterator(_tree.select(k)); }
+	const_iterator nth (size_type k) const { return const_iterator(_tree.select(k)); }
+	// 2) Rank -> number of keys less than k
+	size_type rank (const key_type& k) const { return _tree.rank(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type
+		rank (const K& k) const { return _tree.rank(k); }
+# endif
+# ifdef FT_TREE_STATS
+// TREE STATISTICS (FT_TREE_STATS)
+	// 1) Height, black height and average depth, measured in O(n), with the
+	//    rotations, recolours and erase fix-up loops since the last reset
+	ft::tree_stats tree_statistics () const { return _tree.statistics(); }
+	// 2) Restarts the counters
+	void reset_tree_statistics () { _tree.reset_statistics(); }
+# endif
+// OBSERVERS
+	// Returns the function that compares keys
+	key_compare key_comp() const { return _comp; }
+	value_compare value_comp() const { return value_compare(_comp); }
+private:
+	// Sorted forward ranges are built in a single O(n) pass,
+	// anything else falls back to one insertion per element
+	template <class ForwardIt>
+	void _range_init (ForwardIt first, ForwardIt last, ft::forward_iterator_tag) {
+		if (!_tree.build_equal(first, last))
+			insert(first, last);
+	}
+	template <class InputIt>
+	void _range_init (InputIt first, InputIt last, ft::input_iterator_tag) {
+		insert(first, last);
+	}
+};
+
+// RELATIONAL OPERATORS MULTIMAP
+template< class Key, class T, class Compare, class Alloc >
+bool operator==( const ft::multimap<Key,T,Compare,Alloc>& lhs, const ft::multimap<Key,T,Compare,Alloc>& rhs ) {
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator!= ( const multimap<Key,T,Compare,Alloc>& lhs, const multimap<Key,T,Compare,Alloc>& rhs ) {
+	return !(lhs == rhs);
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator< ( const multimap<Key,T,Compare,Alloc>& lhs, const multimap<Key,T,Compare,Alloc>& rhs ) {
+	return ft::lexicographical_compare (lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator<= ( const multimap<Key,T,Compare,Alloc>& lhs, const multimap<Key,T,Compare,Alloc>& rhs ) {
+	return 	!(rhs < lhs);
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator>  ( const multimap<Key,T,Compare,Alloc>& lhs, const multimap<Key,T,Compare,Alloc>& rhs ) {
+	return rhs < lhs;
+}
+template <class Key, class T, class Compare, class Alloc>
+bool operator>= ( const multimap<Key,T,Compare,Alloc>& lhs, const multimap<Key,T,Compare,Alloc>& rhs ) {
+	return 	!(lhs < rhs);
+}
+//SWAP
+template <class Key, class T, class Compare, class Alloc>
+void swap (multimap<Key,T,Compare,Alloc>& lhs, multimap<Key,T,Compare,Alloc>& rhs) { lhs.swap(rhs); }
+
+}
+
+#endif
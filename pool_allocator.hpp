@@ -0,0 +1,198 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_allocator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:33:19 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 07:18:12 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef POOL_ALLOCATOR_HPP
+# define POOL_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <new>
+# include <limits>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
+namespace ft {
+	//POOL ALLOCATOR
+		// Single objects come from contiguous slabs through a free list,
+		// arrays (n > 1) go straight to operator new.
+		// Copies share the pool, a rebound copy gets a pool of its own.
+		// Freed objects are recycled; slabs go back to the system on
+		// release_all() or when the last copy of the allocator is destroyed.
+	template <class T, std::size_t SlabMax = 4096>
+	class pool_allocator {
+	public:
+		typedef T					value_type;
+		typedef T*					pointer;
+		typedef const T*			const_pointer;
+		typedef T&					reference;
+		typedef const T&			const_reference;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+
+		template <class U>
+		struct rebind {
+			typedef pool_allocator<U, SlabMax>	other;
+		};
+
+	private:
+		template <class U, std::size_t N>
+		friend class pool_allocator;
+
+		struct block {
+			block*		next;
+		};
+		// Slab header, padded so that the blocks keep the strictest alignment
+		union slab {
+			struct {
+				slab*		next;
+				size_type	count;
+			}				h;
+			long double		align_ld;
+			long long		align_ll;
+			void*			align_ptr;
+		};
+		struct pool {
+			slab*		slabs;
+			block*		free;
+			char*		cur;
+			char*		end;
+			size_type	live;
+			size_type	next_count;
+			size_type	refs;
+		};
+
+		// Room for either a T or a free list link, rounded to pointer alignment
+		static const size_type	_block_size = ((sizeof(T) < sizeof(block) ? sizeof(block) : sizeof(T))
+											+ sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+		static const size_type	_first_count = 16;
+
+		pool*	_pool;
+
+	public:
+	// CONSTRUCTORS AND DESTRUCTOR
+		pool_allocator() : _pool(_new_pool()) { }
+		pool_allocator(const pool_allocator& x) : _pool(x._pool) { ++_pool->refs; }
+		template <class U>
+		pool_allocator(const pool_allocator<U, SlabMax>&) : _pool(_new_pool()) { }
+		~pool_allocator() { _unref(); }
+		pool_allocator& operator=(const pool_allocator& x) {
+			if (_pool != x._pool) {
+				++x._pool->refs;
+				_unref();
+				_pool = x._pool;
+			}
+			return *this;
+		}
+
+	// ALLOCATION
+		pointer	allocate(size_type n, const void* = 0) {
+			if (n != 1)
+				return static_cast<pointer>(::operator new(n * sizeof(T)));
+			if (_pool->free != 0) {
+				block*	b = _pool->free;
+
+				_pool->free = b->next;
+				++_pool->live;
+				return reinterpret_cast<pointer>(b);
+			}
+			if (_pool->cur == _pool->end)
+				_add_slab();
+			pointer	p = reinterpret_cast<pointer>(_pool->cur);
+			_pool->cur += _block_size;
+			++_pool->live;
+			return p;
+		}
+		void	deallocate(pointer p, size_type n) {
+			if (n != 1)
+				return ::operator delete(p);
+			block*	b = reinterpret_cast<block*>(p);
+
+			b->next = _pool->free;
+			_pool->free = b;
+			--_pool->live;
+		}
+		// Drops every slab at once when the caller owns all n live objects
+		// of the pool; their destructors are not run
+		bool	release_all(size_type n) {
+			if (_pool->live != n)
+				return false;
+			_release();
+			return true;
+		}
+
+	// UTILS
+		void		construct(pointer p, const_reference val) { ::new(static_cast<void*>(p)) T(val); }
+# if __cplusplus >= 201103L
+		template <class U, class... Args>
+		void		construct(U* p, Args&&... args) { ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+# endif
+		void		destroy(pointer p) { p->~T(); }
+		pointer			address(reference x) const { return &x; }
+		const_pointer	address(const_reference x) const { return &x; }
+		size_type	max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+		size_type	live() const { return _pool->live; }
+
+		template <class U>
+		bool	operator==(const pool_allocator<U, SlabMax>& x) const {
+			return static_cast<const void*>(_pool) == static_cast<const void*>(x._pool);
+		}
+		template <class U>
+		bool	operator!=(const pool_allocator<U, SlabMax>& x) const { return !(*this == x); }
+
+	private:
+		static pool*	_new_pool() {
+			pool*	p = new pool;
+
+			p->slabs = 0; p->free = 0; p->cur = 0; p->end = 0;
+			p->live = 0; p->next_count = _first_count; p->refs = 1;
+			return p;
+		}
+		void	_unref() {
+			if (--_pool->refs == 0) {
+				_release();
+				delete _pool;
+			}
+		}
+		// Slabs grow geometrically up to SlabMax objects
+		void	_add_slab() {
+			size_type	count = _pool->next_count;
+			slab*		s = static_cast<slab*>(::operator new(sizeof(slab) + count * _block_size));
+
+			s->h.next = _pool->slabs;
+			s->h.count = count;
+			_pool->slabs = s;
+			_pool->cur = reinterpret_cast<char*>(s + 1);
+			_pool->end = _pool->cur + count * _block_size;
+			if (count < SlabMax)
+				_pool->next_count = (count * 2 < SlabMax) ? count * 2 : SlabMax;
+		}
+		// O(slabs): frees every slab and forgets the free list
+		void	_release() {
+			for (slab* s = _pool->slabs; s != 0; ) {
+				slab*	next = s->h.next;
+
+				::operator delete(s);
+				s = next;
+			}
+			_pool->slabs = 0; _pool->free = 0; _pool->cur = 0; _pool->end = 0;
+			_pool->live = 0; _pool->next_count = _first_count;
+		}
+	};
+
+	// Tree hook (see tree::clear): a pool can drop all the nodes of a tree at once
+	template <class T, std::size_t SlabMax>
+	bool	release_all(pool_allocator<T, SlabMax>& alloc, std::size_t n) {
+		return alloc.release_all(n);
+	}
+}
+
+#endif
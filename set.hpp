@@ -6,7 +6,7 @@
 /*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/08 16:06:18 by doreshev          #+#    #+#             */
-/*   Updated: 2022/11/14 13:45:55 by doreshev         ###   ########.fr       */
+/*   Updated: 2026/10/18 08:14:19 by doreshev         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,7 @@
 
 # include <stdexcept>
 # include "iterators/tree.hpp"
+# include "vector.hpp"
 
 namespace ft {
 template< class Key, class Compare = std::less<Key>, class Allocator = std::allocator<Key> >
@@ -32,7 +33,7 @@ public:
 	typedef typename allocator_type::difference_type					difference_type;
 	typedef	typename allocator_type::size_type							size_type;
 
-	typedef	ft::tree<value_type, key_compare, allocator_type>			tree;
+	typedef	ft::tree<key_type, value_type, ft::identity<value_type>, key_compare, allocator_type>	tree;
 	typedef	typename tree::const_iterator								iterator;
 	typedef	typename tree::const_iterator								const_iterator;
 	typedef	typename tree::const_reverse_iterator						reverse_iterator;
@@ -48,21 +49,26 @@ public:
 	// CONSTRUCTORS
 		// 1) Empty
 	explicit set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
-				: _comp(comp), _alloc(alloc), _tree() { }
+				: _comp(comp), _alloc(alloc), _tree(comp, alloc) { }
 		// 2) Range
 	template <class InputIterator>
 	set (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
-		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _tree() {
-		insert(first, last);
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _tree(comp, alloc) {
+		_range_init(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+	}
+		// 3) Range already sorted by comp without equivalent keys
+	template <class InputIterator>
+	set (ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc(alloc), _tree(comp, alloc) {
+		_sorted_init(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 	}
-		// 3) Copy
+		// 4) Copy
 	set (const set& x) : _comp(x.key_comp()), _alloc(x.get_allocator()), _tree(x._tree) { }
 	// DESTRUCTOR
 	~set () { }
 	// ASSIGN OPERATOR
 		//assigns values to the container
 	set& operator= (const set& x) {
-		_alloc = x.get_allocator();
 		_comp = x.key_comp();
 		_tree = x._tree;
 		return *this;
@@ -111,8 +117,7 @@ public:
 	pair<iterator,bool> insert (const value_type& val) { return _tree.insert(val); }
 		// b) With hint 
 	iterator insert (iterator position, const value_type& val) {
-		(void)position;
-		return _tree.insert(val).first;
+		return _tree.insert(position, val);
 	}
 		// c) Range
 	template <class InputIterator>
@@ -122,26 +127,52 @@ public:
 	}
 	// 3) Erase -> Removes from container elements
 		// a) Removes element in given position
-	void erase (iterator position) { _tree.erase(*position); }
+	void erase (iterator position) { _tree.erase(position.base()); }
 		// b) Removes element with given key
 	size_type erase (const key_type& k) { return _tree.erase(k); }
 		// c) Removes elemets in given range
 	void erase (iterator first, iterator last) {
-		while (first != last)
-			_tree.erase(*first++);
+		_tree.erase(first.base(), last.base());
 	}
 	// 4) Swap -> Exchanges the content of the container by the content of x
 	void swap (set& x) {
 		_tree.swap(x._tree);
 	}
+	// 5) Split -> moves the elements not less than k into right, replacing
+	//    its content, in O(log n) (see tree::split)
+	void split (const key_type& k, set& right) {
+		if (&right == this)
+			return ;
+		_tree.split(k, right._tree);
+		right._comp = _comp;
+		right._alloc = _alloc;
+	}
+	// 6) Join -> moves every element of right to the end of this set: O(log n)
+	//    when all of them are greater than those here and the allocators are
+	//    equal, otherwise they are inserted one at a time
+	void join (set& right) {
+		if (&right == this || _tree.join(right._tree))
+			return ;
+		insert(right.begin(), right.end());
+		right.clear();
+	}
 // LOOKUP (Operations)
+	//    Every lookup also has a template overload taking any K the comparator
+	//    accepts, enabled when key_compare is transparent (e.g. ft::less<>)
 	// 1) Count -> Count elements with a specific key
-	size_type count (const key_type& k) const {
-		return _tree.count(k);
-	}
+	size_type count (const key_type& k) const { return _tree.count(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type
+		count (const K& k) const { return _tree.count(k); }
 	// 2) Find -> finds element with specific key
 	iterator find (const key_type& k) { return iterator(_tree.iter_find(k)); }
 	const_iterator find (const key_type& k) const { return const_iterator(_tree.iter_find(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		find (const K& k) { return iterator(_tree.iter_find(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		find (const K& k) const { return const_iterator(_tree.iter_find(k)); }
 	// 3) Get range of equal elements
 	pair<const_iterator,const_iterator> equal_range (const key_type& k) const {
 		return ft::make_pair(lower_bound(k), upper_bound(k));
@@ -149,16 +180,73 @@ public:
 	pair<iterator,iterator> equal_range (const key_type& k) {
 		return ft::make_pair(lower_bound(k), upper_bound(k));
 	}
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<const_iterator,const_iterator> >::type
+		equal_range (const K& k) const { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<iterator,iterator> >::type
+		equal_range (const K& k) { return ft::make_pair(lower_bound(k), upper_bound(k)); }
 	// 4) Return iterator to lower bound
 	iterator lower_bound (const key_type& k) { return _tree.lower_bound(k); }
 	const_iterator lower_bound (const key_type& k) const { return _tree.lower_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		lower_bound (const K& k) { return _tree.lower_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		lower_bound (const K& k) const { return _tree.lower_bound(k); }
 	// 5) Return iterator to upper bound
 	iterator upper_bound (const key_type& k) { return _tree.upper_bound(k); }
 	const_iterator upper_bound (const key_type& k) const { return _tree.upper_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, iterator>::type
+		upper_bound (const K& k) { return _tree.upper_bound(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, const_iterator>::type
+		upper_bound (const K& k) const { return _tree.upper_bound(k); }
+# ifdef FT_TREE_ORDER_STATISTICS
+// ORDER STATISTICS (FT_TREE_ORDER_STATISTICS), O(log n)
+	// 1) Nth -> element at position k in key order, end() when k >= size()
+	iterator nth (size_type k) { return iterator(_tree.select(k)); }
+	const_iterator nth (size_type k) const { return const_iterator(_tree.select(k)); }
+	// 2) Rank -> number of keys less than k
+	size_type rank (const key_type& k) const { return _tree.rank(k); }
+	template <class K>
+	typename ft::enable_if<ft::is_transparent<Compare, K>::value, size_type>::type
+		rank (const K& k) const { return _tree.rank(k); }
+# endif
+# ifdef FT_TREE_STATS
+// TREE STATISTICS (FT_TREE_STATS)
+	// 1) Height, black height and average depth, measured in O(n), with the
+	//    rotations, recolours and erase fix-up loops since the last reset
+	ft::tree_stats tree_statistics () const { return _tree.statistics(); }
+	// 2) Restarts the counters
+	void reset_tree_statistics () { _tree.reset_statistics(); }
+# endif
 // OBSERVERS
 	// Returns the function that compares keys
 	key_compare key_comp() const { return _comp; }
 	value_compare value_comp() const { return _comp; }
+private:
+	// Sorted forward ranges are built in a single O(n) pass,
+	// anything else falls back to one insertion per element
+	template <class ForwardIt>
+	void _range_init (ForwardIt first, ForwardIt last, ft::forward_iterator_tag) {
+		if (!_tree.build(first, last))
+			insert(first, last);
+	}
+	template <class InputIt>
+	void _range_init (InputIt first, InputIt last, ft::input_iterator_tag) {
+		insert(first, last);
+	}
+	template <class ForwardIt>
+	void _sorted_init (ForwardIt first, ForwardIt last, ft::forward_iterator_tag) {
+		_tree.build_unique(first, last, ft::distance(first, last));
+	}
+	template <class InputIt>
+	void _sorted_init (InputIt first, InputIt last, ft::input_iterator_tag) {
+		insert(first, last);
+	}
 };
 
 // RELATIONAL OPERATORS set
@@ -191,6 +279,43 @@ bool operator>= ( const set<Key,Compare,Alloc>& lhs, const set<Key,Compare,Alloc
 //SWAP
 template <class Key, class Compare, class Alloc>
 void swap (set<Key,Compare,Alloc>& lhs, set<Key,Compare,Alloc>& rhs) { lhs.swap(rhs); }
+//SET OPERATIONS
+	// Both sets are merged in key order into a buffer, which then builds the
+	// result like the sorted_unique constructor: O(n + m) overall, where n + m
+	// inserts would cost O((n + m) log(n + m)). The result keeps lhs's
+	// comparator and allocator
+template <class Key, class Compare, class Alloc>
+set<Key,Compare,Alloc>	set_union (const set<Key,Compare,Alloc>& lhs, const set<Key,Compare,Alloc>& rhs) {
+	ft::vector<Key>	buf;
+
+	buf.reserve(lhs.size() + rhs.size());
+	ft::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), ft::back_inserter(buf), lhs.key_comp());
+	return set<Key,Compare,Alloc>(ft::sorted_unique, buf.begin(), buf.end(), lhs.key_comp(), lhs.get_allocator());
+}
+template <class Key, class Compare, class Alloc>
+set<Key,Compare,Alloc>	set_intersection (const set<Key,Compare,Alloc>& lhs, const set<Key,Compare,Alloc>& rhs) {
+	ft::vector<Key>	buf;
+
+	buf.reserve(lhs.size() < rhs.size() ? lhs.size() : rhs.size());
+	ft::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), ft::back_inserter(buf), lhs.key_comp());
+	return set<Key,Compare,Alloc>(ft::sorted_unique, buf.begin(), buf.end(), lhs.key_comp(), lhs.get_allocator());
+}
+template <class Key, class Compare, class Alloc>
+set<Key,Compare,Alloc>	set_difference (const set<Key,Compare,Alloc>& lhs, const set<Key,Compare,Alloc>& rhs) {
+	ft::vector<Key>	buf;
+
+	buf.reserve(lhs.size());
+	ft::set_difference(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), ft::back_inserter(buf), lhs.key_comp());
+	return set<Key,Compare,Alloc>(ft::sorted_unique, buf.begin(), buf.end(), lhs.key_comp(), lhs.get_allocator());
+}
+template <class Key, class Compare, class Alloc>
+set<Key,Compare,Alloc>	set_symmetric_difference (const set<Key,Compare,Alloc>& lhs, const set<Key,Compare,Alloc>& rhs) {
+	ft::vector<Key>	buf;
+
+	buf.reserve(lhs.size() + rhs.size());
+	ft::set_symmetric_difference(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), ft::back_inserter(buf), lhs.key_comp());
+	return set<Key,Compare,Alloc>(ft::sorted_unique, buf.begin(), buf.end(), lhs.key_comp(), lhs.get_allocator());
+}
 
 }
 
@@ -6,17 +6,17 @@
 /*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/08 16:03:41 by doreshev          #+#    #+#             */
-/*   Updated: 2022/10/28 19:29:09 by doreshev         ###   ########.fr       */
+/*   Updated: 2026/10/18 08:25:47 by doreshev         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef STACK_HPP
 # define STACK_HPP
 
-# include "vector.hpp"
+# include "deque.hpp"
 
 namespace ft {
-	template<class T, class Container = ft::vector<T> >
+	template<class T, class Container = ft::deque<T> >
 	class stack	{
 		public:
 			typedef	T									value_type;
@@ -42,7 +42,7 @@ int main(void)
 		std::list<int> mylist;
 		ft::stack<int> first; //empty stack
 		// ft::stack<int> second(mydeque); //stack initialized to copy of deque [si container=vector no funciona]
-		ft::stack<int> second(myftvector); //stack initialized to copy of deque [si container=vector no funciona]
+		ft::stack<int, ft::vector<int> > second(myftvector); //stack initialized to copy of vector
 		ft::stack<int, std::vector<int> > third; //empty stack using vector
 		ft::stack<int, std::vector<int> > fourth(myvector);
 		ft::stack<int, std::list<int> > fifth(mylist);
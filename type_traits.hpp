@@ -6,13 +6,17 @@
 /*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/19 11:51:25 by doreshev          #+#    #+#             */
-/*   Updated: 2022/11/14 15:12:48 by doreshev         ###   ########.fr       */
+/*   Updated: 2026/10/18 08:54:49 by doreshev         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef TYPE_TRAITS_HPP
 # define TYPE_TRAITS_HPP
 
+# if __cplusplus >= 201103L
+#  include <type_traits>
+# endif
+
 namespace ft {
 	//ENABLE IF
 	template<bool B, class T = void>
@@ -155,6 +159,65 @@ namespace ft {
 	struct is_integral<unsigned volatile long long int> : public true_type { };
 	template <>
 	struct is_integral<const volatile unsigned long long int> : public true_type { };
+
+	//IS TRANSPARENT
+		// true when Compare declares an is_transparent type, which opts map and
+		// set into heterogeneous lookup; K only makes the test depend on the
+		// lookup's template parameter so that it can be used in enable_if
+	template <class Compare, class K = void>
+	struct is_transparent {
+	private:
+		typedef char	yes;
+		typedef char	no[2];
+
+		template <class U>
+		static yes&	test(typename U::is_transparent*);
+		template <class U>
+		static no&	test(...);
+	public:
+		static const bool	value = sizeof(test<Compare>(0)) == sizeof(yes);
+	};
+
+	//IS TRIVIALLY COPYABLE / DESTRUCTIBLE
+		// compiler intrinsics, also available in C++98 mode on gcc and clang
+# if defined(__clang__)
+#  define FT_TRIVIALLY_DESTRUCTIBLE(T) __is_trivially_destructible(T)
+# else
+#  define FT_TRIVIALLY_DESTRUCTIBLE(T) __has_trivial_destructor(T)
+# endif
+
+	template <class T>
+	struct is_trivially_copyable : public integral_constant<bool, __is_trivially_copyable(T)> { };
+
+	template <class T>
+	struct is_trivially_destructible : public integral_constant<bool, FT_TRIVIALLY_DESTRUCTIBLE(T)> { };
+
+	//IS NOTHROW RELOCATABLE
+		// a T can be moved to raw storage without throwing: trivially
+		// copyable, nothrow move constructible, or in C++98 nothrow copy
+		// constructible
+# if __cplusplus >= 201103L
+#  define FT_NOTHROW_RELOCATE(T) std::is_nothrow_move_constructible<T>::value
+# elif defined(__clang__)
+#  define FT_NOTHROW_RELOCATE(T) __is_nothrow_constructible(T, const T&)
+# else
+#  define FT_NOTHROW_RELOCATE(T) __has_nothrow_copy(T)
+# endif
+
+	template <class T>
+	struct is_nothrow_relocatable
+		: public integral_constant<bool, __is_trivially_copyable(T) || FT_NOTHROW_RELOCATE(T)> { };
+
+	//REMOVE CONST
+	template <class T>
+	struct remove_const {
+		typedef T type;
+	};
+
+	template <class T>
+	struct remove_const<const T> {
+		typedef T type;
+	};
 }
 
 #endif
\ No newline at end of file
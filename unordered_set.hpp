@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_set.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:34:50 by doreshev          #+#    #+#             */
+/*   Updated: 2026/10/18 09:35:10 by doreshev         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef UNORDERED_SET_HPP
+# define UNORDERED_SET_HPP
+
+# include "iterators/hashtable.hpp"
+# include "vector.hpp"
+
+namespace ft {
+// Hash set over an open addressing table (iterators/hashtable.hpp):
+// insertion and erasure invalidate every iterator, so unlike std's,
+// erase(iterator) returns void: there is no next element to return
+template<class Key, class Hash = ft::hash<Key>, class KeyEqual = ft::equal_to<Key>, class Allocator = std::allocator<Key> >
+class unordered_set {
+public:
+	typedef	Key															key_type;
+	typedef	Key															value_type;
+	typedef	Hash														hasher;
+	typedef	KeyEqual													key_equal;
+	typedef	Allocator													allocator_type;
+	typedef	typename allocator_type::reference							reference;
+	typedef	typename allocator_type::const_reference					const_reference;
+	typedef	typename allocator_type::pointer							pointer;
+	typedef	typename allocator_type::const_pointer						const_pointer;
+	typedef	typename allocator_type::size_type							size_type;
+	typedef typename allocator_type::difference_type					difference_type;
+
+	typedef	ft::hashtable<key_type, value_type, ft::identity<value_type>, hasher, key_equal, allocator_type>	table;
+	typedef	typename table::const_iterator							iterator;
+	typedef	typename table::const_iterator							const_iterator;
+
+private:
+	allocator_type			_alloc;
+	table					_table;
+
+public:
+// MEMBER FUNCTIONS
+	// CONSTRUCTORS
+		// 1) Empty, with room for about n elements
+	explicit unordered_set (size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+		const allocator_type& alloc = allocator_type()) : _alloc(alloc), _table(n, hf, eql, alloc) { }
+		// 2) Range
+	template <class InputIterator>
+	unordered_set (InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(),
+		const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+		: _alloc(alloc), _table(n, hf, eql, alloc) {
+		insert(first, last);
+	}
+		// 3) Copy
+	unordered_set (const unordered_set& x) : _alloc(x._alloc), _table(x._table) { }
+	// DESTRUCTOR
+	~unordered_set () { }
+	// ASSIGN OPERATOR
+	unordered_set& operator= (const unordered_set& x) {
+		_table = x._table;
+		return *this;
+	}
+	// ALLOCATOR GETTER -> Returns allocator
+	allocator_type get_allocator() const { return _alloc; }
+
+// ITERATORS
+	iterator begin() const { return _table.begin(); }
+	iterator end() const { return _table.end(); }
+// CAPACITY
+	bool empty() const { return _table.empty(); }
+	size_type size() const { return _table.size(); }
+	size_type max_size() const { return _table.max_size(); }
+// MODIFIERS
+	// 1) Removes all elements, keeps the slots
+	void clear() { _table.clear(); }
+	// 2) Insertion of elements
+		// a) Single element
+	pair<iterator,bool> insert (const value_type& val) {
+		pair<typename table::iterator,bool>	res = _table.insert(val);
+
+		return ft::make_pair(iterator(res.first), res.second);
+	}
+		// b) With hint, which is not used
+	iterator insert (iterator position, const value_type& val) {
+		(void)position;
+		return _table.insert(val).first;
+	}
+		// c) Range
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last) {
+		for (; first != last; ++first)
+			_table.insert(*first);
+	}
+	// 3) Erase -> Removes from container elements
+		// a) Removes element in given position
+	void erase (iterator position) { _table.erase(position); }
+		// b) Removes element with given key
+	size_type erase (const key_type& k) { return _table.erase_key(k); }
+		// c) Removes elemets in given range: erasing moves values between
+		//    slots, so the keys are collected first
+	void erase (iterator first, iterator last) {
+		ft::vector<key_type>	keys;
+
+		if (first == begin() && last == end())
+			return clear();
+		keys.assign(first, last);
+		for (typename ft::vector<key_type>::iterator it = keys.begin(); it != keys.end(); ++it)
+			_table.erase_key(*it);
+	}
+	// 4) Swap -> Exchanges the content of the container by the content of x
+	void swap (unordered_set& x) {
+		_table.swap(x._table);
+		ft::swap(_alloc, x._alloc);
+	}
+// LOOKUP (Operations)
+	// 1) Count -> Count elements with a specific key
+	size_type count (const key_type& k) const { return _table.count(k); }
+	// 2) Find -> finds element with specific key
+	iterator find (const key_type& k) const { return _table.find(k); }
+	// 3) Get range of equal elements
+	pair<iterator,iterator> equal_range (const key_type& k) const {
+		iterator	it = find(k);
+
+		return ft::make_pair(it, it == end() ? it : ++iterator(it));
+	}
+// HASH POLICY
+	size_type bucket_count() const { return _table.bucket_count(); }
+	float load_factor() const { return _table.load_factor(); }
+	float max_load_factor() const { return _table.max_load_factor(); }
+	// Clamped to [0.125, 1], 0.875 by default
+	void max_load_factor(float ml) { _table.max_load_factor(ml); }
+	// Sets the slot count to at least n, and enough for size()
+	void rehash(size_type n) { _table.rehash(n); }
+	// Room for n elements without growing
+	void reserve(size_type n) { _table.reserve(n); }
+// OBSERVERS
+	hasher hash_function() const { return _table.hash_function(); }
+	key_equal key_eq() const { return _table.key_eq(); }
+};
+
+// RELATIONAL OPERATORS UNORDERED SET
+template <class Key, class Hash, class Pred, class Alloc>
+bool operator== ( const unordered_set<Key,Hash,Pred,Alloc>& lhs, const unordered_set<Key,Hash,Pred,Alloc>& rhs ) {
+	typedef typename unordered_set<Key,Hash,Pred,Alloc>::const_iterator	const_iterator;
+
+	if (lhs.size() != rhs.size())
+		return false;
+	for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+		if (rhs.count(*it) == 0)
+			return false;
+	return true;
+}
+template <class Key, class Hash, class Pred, class Alloc>
+bool operator!= ( const unordered_set<Key,Hash,Pred,Alloc>& lhs, const unordered_set<Key,Hash,Pred,Alloc>& rhs ) {
+	return !(lhs == rhs);
+}
+//SWAP
+template <class Key, class Hash, class Pred, class Alloc>
+void swap (unordered_set<Key,Hash,Pred,Alloc>& lhs, unordered_set<Key,Hash,Pred,Alloc>& rhs) { lhs.swap(rhs); }
+
+}
+
+#endif
@@ -6,14 +6,24 @@
 /*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/08 16:04:46 by doreshev          #+#    #+#             */
-/*   Updated: 2022/10/31 12:18:23 by doreshev         ###   ########.fr       */
+/*   Updated: 2026/10/18 08:54:49 by doreshev         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef UTILITY_HPP
 # define UTILITY_HPP
 
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
 namespace ft{
+	////EMPLACE SECOND TAG
+	// Selects the pair constructors copying the key into first and building
+	// second from the remaining arguments, for map::try_emplace
+	struct emplace_second_t { emplace_second_t() { } };
+	static const emplace_second_t	emplace_second;
+
 	template <class T1, class T2>
 	struct pair {
 		public:
@@ -29,21 +39,35 @@ namespace ft{
 			//1)default
 			pair() : first(), second() { }
 
-			//2)copy
+			//2)copy: the implicit copy (and move) constructor and assignment,
+			//  so a pair of trivially copyable or nothrow movable members is
+			//  one as well and containers can relocate it without throwing
 			template<class U, class V>
 			pair( const pair<U,V>& pr ) : first( pr.first ), second( pr.second ) { }
 
 			//3)initialization
 			pair( const first_type& a, const second_type& b ) : first( a ), second( b ) { }
-			
-			////COPY ASSIGNMENT OPERATOR
-			pair& operator=( const pair& pr ) {
-				this->first = pr.first;
-				this->second = pr.second;
-				return(*this);
-			}
+# if __cplusplus >= 201103L
+			pair( const first_type& a, second_type&& b ) : first( a ), second( std::move(b) ) { }
+# endif
+
+			//4)second built in place: direct-initialized, never a temporary
+# if __cplusplus >= 201103L
+			template <class... Args>
+			pair( emplace_second_t, const first_type& a, Args&&... args )
+				: first( a ), second( std::forward<Args>(args)... ) { }
+# else
+			pair( emplace_second_t, const first_type& a ) : first( a ), second() { }
+			pair( emplace_second_t, const first_type& a, const second_type& b ) : first( a ), second( b ) { }
+# endif
 	};
 	
+	////SORTED UNIQUE TAG
+	// Selects the map/set constructors taking a range already sorted by the
+	// comparator and free of equivalent keys
+	struct sorted_unique_t { sorted_unique_t() { } };
+	static const sorted_unique_t	sorted_unique;
+
 	////MAKEPAIR
 	template <class T1,class T2>
   	pair<T1,T2> make_pair( T1 x, T2 y )
@@ -6,7 +6,7 @@
 /*   By: doreshev <doreshev@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/08 16:03:14 by doreshev          #+#    #+#             */
-/*   Updated: 2022/11/14 15:35:46 by doreshev         ###   ########.fr       */
+/*   Updated: 2026/10/18 07:24:10 by doreshev         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,10 +14,17 @@
 # define VECTOR_HPP
 
 # include <stdexcept>
+# include <limits>
+# include <cstring>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
 # include "iterators/VectorIterator.hpp"
 # include "algorithm.hpp"
 # include "type_traits.hpp"
 
+# define VECTOR_COPY_BLOCK 4096
+
 namespace ft {
 	template<class T, class Allocator = std::allocator<T> >
 	class vector {
@@ -61,16 +68,25 @@ namespace ft {
 		// 4) Copy
 		vector ( const vector& x ) : _size(0), _cap(0), _begin(nullptr), _alloc(x.get_allocator()) { 
 			_vallocate(x.capacity());
-			for ( ; _size < x._size; _size++) {
-				try {
-					_alloc.construct(_begin + _size, x[_size]);
-				}
-				catch(...) {
-					_vdeallocate();
-				}
+			try {
+				_vcopy(x._begin, x._begin + x._size, _begin);
 			}
+			catch(...) {
+				_vdeallocate();
+				throw;
+			}
+			_size = x._size;
 		}
 
+# if __cplusplus >= 201103L
+		// 5) Move: takes over x's buffer and leaves x empty
+		vector ( vector&& x ) noexcept : _size(x._size), _cap(x._cap), _begin(x._begin), _alloc(x._alloc) {
+			x._size = 0;
+			x._cap = 0;
+			x._begin = nullptr;
+		}
+# endif
+
 	// DESTRUCTOR
 		~vector() { _vdeallocate(); }
 
@@ -81,6 +97,17 @@ namespace ft {
 			assign(x.begin(), x.end());
 			return *this;
 		}
+# if __cplusplus >= 201103L
+		vector& operator=( vector&& x ) noexcept {
+			if (this != &x) {
+				_vdeallocate();
+				_alloc = x._alloc;
+				_begin = x._begin; _size = x._size; _cap = x._cap;
+				x._begin = nullptr; x._size = 0; x._cap = 0;
+			}
+			return *this;
+		}
+# endif
 
 	// ASSIGN - Assigns new contents to the vector, replacing its current contents
 		// 1) Fill
@@ -177,19 +204,15 @@ namespace ft {
 				throw std::length_error("ft::vector");
 			else if (new_cap > _cap) {
 				pointer	tmp = _pallocate(new_cap);
-				size_type i = 0;
-				for ( ; i < _size; i++) {
-					try {
-						_alloc.construct(tmp + i, _begin[i]);
-					}
-					catch(...) {
-						for (size_type j = 0; j < i; j++)	
-							_alloc.destroy(tmp + i);
-						_alloc.deallocate(tmp, new_cap);
-					}
+
+				try {
+					_vmove(_begin, _begin + _size, tmp);
 				}
-				_vdeallocate();
-				_begin = tmp; _size = i; _cap = new_cap;
+				catch(...) {
+					_alloc.deallocate(tmp, new_cap);
+					throw;
+				}
+				_vreplace(tmp, _size, new_cap);
 			}
 		}
 		// 5) Capacity of the vector
@@ -200,69 +223,20 @@ namespace ft {
 	// MODIFIERS
 		// 1) Clearing array, calling destructor to all members;
 		void	clear() {
-			for (; _size != 0; --_size) {
-				_alloc.destroy(_begin + _size - 1);
-			}
+			_destroy_range(_begin, _begin + _size);
+			_size = 0;
 		}
 		// 2) Inserting value to the given position
 			// a) Single Element
 		iterator	insert( iterator position, const value_type& val ) {
-			pointer		tmp;
-			size_type	cap = _vcapcheck();
-			size_type	dist = static_cast<size_type>(ft::distance(begin(), position));
-			size_type	i = 0;
+			size_type	pos = static_cast<size_type>(position - begin());
 
-			if (position == end()) {
-				push_back(val);
-				return &back();
-			}
-			tmp = _pallocate(cap);
-			for (size_type k = 0; i < _size; i++) {
-				try {
-					if (i == dist) {
-						_alloc.construct(tmp + i, val);
-						k = 1;
-					}
-					_alloc.construct(tmp + i + k, _begin[i]);
-				}
-				catch(...) {
-					for (size_type j = 0; j < i + k; j++)
-						_alloc.destroy(tmp + i + k);
-					_alloc.deallocate(tmp, cap);
-				}
-			}
-			_vdeallocate();
-			_begin = tmp; _size = i + 1; _cap = cap;
-			return iterator(_begin + dist);
+			_insertfill(pos, 1, val);
+			return iterator(_begin + pos);
 		}
 			// b) Fill
 		void	insert (iterator position, size_type n, const value_type& val) {
-			pointer		new_vec;
-			size_type	new_cap = _vcapcheck();
-			size_type	new_size = n + _size;
-			size_type	pos = static_cast<size_type>(ft::distance(begin(), position));
-			size_type	i = 0;
-
-			if (new_size > new_cap)
-				new_cap = new_size;
-			new_vec = _pallocate(new_cap);
-			for (size_type k = 0; i < new_size; i++) {
-				try {
-					if (i == pos) {
-						for ( ; k < n; k++)
-							_alloc.construct(new_vec + i + k, val);
-					}
-					if (i < _size)
-						_alloc.construct(new_vec + i + k, *(_begin + i));
-				}
-				catch(...) {
-					for (size_type j = 0; j < i + k; j++)
-						_alloc.destroy(new_vec + i + k);
-					_alloc.deallocate(new_vec, new_cap);
-				}
-			}
-			_vdeallocate();
-			_begin = new_vec; _size = new_size; _cap = new_cap;
+			_insertfill(static_cast<size_type>(position - begin()), n, val);
 		}
 			// c) Range
 		template <class Iterator>
@@ -271,53 +245,70 @@ namespace ft {
 			_insertrange(position, first, last,
 						typename iterator_traits<Iterator>::iterator_category());
 		}
-		// 3) Removing element from given position
-			// a) Single Element
-		iterator	erase(iterator position) {
-			iterator	last(_begin + _size - 1);
+# if __cplusplus >= 201103L
+			// a) Single Element, moved in
+		iterator	insert( iterator position, value_type&& val ) {
+			return emplace(position, std::move(val));
+		}
+			// d) Emplace: constructs the element in place from args
+		template <class... Args>
+		iterator emplace (iterator position, Args&&... args) {
+			size_type	pos = static_cast<size_type>(position - begin());
 
-			try	{
-				_vdestroy(&(*position));
-				for (iterator	tmp = position; tmp != last; tmp++) {
-					_alloc.construct(&(*tmp), *(tmp + 1));
-					_alloc.destroy(&(*(tmp + 1)));
-				}
+			if (_size == _cap)
+				_reallocemplace(pos, std::forward<Args>(args)...);
+			else if (pos == _size) {
+				_alloc.construct(_begin + _size, std::forward<Args>(args)...);
+				_size++;
 			}
-			catch(...) {
-				_vdeallocate();
+			else {
+				// args may refer to elements that are about to be moved
+				value_type	tmp(std::forward<Args>(args)...);
+				pointer		old_end = _begin + _size;
+
+				_alloc.construct(old_end, std::move(*(old_end - 1)));
+				_size++;
+				_vshift(_begin + pos, old_end - 1, _begin + pos + 1);
+				_begin[pos] = std::move(tmp);
 			}
-			return position;
+			return iterator(_begin + pos);
+		}
+# endif
+		// 3) Removing element from given position
+			// a) Single Element
+		iterator	erase(iterator position) {
+			return erase(position, position + 1);
 		}
-			//b) Range 
+			//b) Range: shifts the tail down and destroys what is left behind
 		iterator	erase(iterator first, iterator last) {
-			iterator	end(_begin + _size);
-
 			if (first != last) {
-				try	{
-					for (iterator tmp = first; tmp != last; tmp++)
-						_vdestroy(&(*tmp));
-					for (iterator tmp = first; last != end; last++, tmp++) {
-						_alloc.construct(&(*tmp), *last);
-						_alloc.destroy(&(*last));
-					}
-				}
-				catch(...) {
-					_vdeallocate();
-				}
+				pointer	new_end = _vshift(last.base(), _begin + _size, first.base());
+
+				_destroy_range(new_end, _begin + _size);
+				_size = static_cast<size_type>(new_end - _begin);
 			}
 			return first;
 		}
 		// 4) Adds the last element of the container
 		void push_back (const value_type& val) {
-			reserve(_vcapcheck());
-			try {
-				_alloc.construct(_begin + _size, val);
-			}
-			catch(...) {
-				_vdeallocate();
-			}
+			if (_size == _cap)
+				return _reallocfill(_size, 1, val);
+			_alloc.construct(_begin + _size, val);
 			_size++;
 		}
+# if __cplusplus >= 201103L
+		void push_back (value_type&& val) {
+			emplace_back(std::move(val));
+		}
+			// constructs the last element in place from args
+		template <class... Args>
+		void emplace_back (Args&&... args) {
+			if (_size == _cap)
+				return _reallocemplace(_size, std::forward<Args>(args)...);
+			_alloc.construct(_begin + _size, std::forward<Args>(args)...);
+			_size++;
+		}
+# endif
 		// 5) Removes the last element of the container
 		void	pop_back() {
 			if (_size != 0) {
@@ -338,7 +329,7 @@ namespace ft {
 		}
 		// 7) Swap values of the vector with given one;
 		void	swap( vector& x ) {
-			if (*this != x) {
+			if (this != &x) {
 				ft::swap(_begin, x._begin);
 				ft::swap(_cap, x._cap);
 				ft::swap(_size, x._size);
@@ -363,15 +354,17 @@ namespace ft {
 				_cap = 0;
 			}
 		}
-		// 3) Checks capacity to allocate
-		size_type	_vcapcheck() {
-			size_type	cap = _cap;
+		// 3) Capacity to allocate for at least n elements: geometric (x2) growth
+		size_type	_vgrowth(size_type n) const {
+			size_type	max = max_size();
 
-			if (_cap == 0)
-				cap = 1;
-			else if (_cap == _size)
-				cap = _cap * 2;
-			return (cap);
+			if (n > max)
+				throw std::length_error("ft::vector");
+			if (_cap > max / 2)
+				return max;
+			if (n < _cap * 2)
+				return _cap * 2;
+			return n;
 		}
 		// 4) Allocates n memory and returns pointer to it
 		pointer	_pallocate(size_type n) {
@@ -413,36 +406,50 @@ namespace ft {
 				push_back(*first);
 		}
 		// 7) Insert Range
-			// for random_access_iterator 
+			// for forward iterators: size known, shifts in place when capacity allows
 		template <class Iterator>
-		void _insertrange (iterator position, Iterator first, Iterator last, random_access_iterator_tag) {
-			pointer		new_vec;
-			size_type	new_cap = _vcapcheck();
-			size_type	pos = static_cast<size_type>(ft::distance(begin(), position));
-			size_type	dist = static_cast<size_type>(ft::distance(first, last));
-			size_type	new_size = dist + _size;
-			size_type	i = 0;
-
-			if (new_size > new_cap)
-				new_cap = new_size;
-			new_vec = _pallocate(new_cap);
-			try {
-				for (size_type j = 0; i < new_size; i++, j++) {
-					if (i == pos) {
-						for (; first != last; first++, i++)
-							_alloc.construct(new_vec + i, *first);
-					}
-					if (j < _size)
-						_alloc.construct(new_vec + i, *(_begin + j));
+		void _insertrange (iterator position, Iterator first, Iterator last, forward_iterator_tag) {
+			size_type	pos = static_cast<size_type>(position - begin());
+			size_type	n = static_cast<size_type>(ft::distance(first, last));
+
+			if (n == 0)
+				return ;
+			if (_size + n <= _cap) {
+				pointer		p = _begin + pos;
+				pointer		old_end = _begin + _size;
+				size_type	after = _size - pos;
+
+				if (after > n) {
+					_vmove(old_end - n, old_end, old_end);
+					_size += n;
+					_vshift(p, old_end - n, p + n);
+					ft::copy(first, last, p);
+				}
+				else {
+					Iterator	mid = first;
+
+					for (size_type i = 0; i < after; i++)
+						++mid;
+					_uninit_copy(mid, last, old_end);
+					_size += n - after;
+					_vmove(p, old_end, _begin + _size);
+					_size += after;
+					ft::copy(first, mid, p);
 				}
+				return ;
+			}
+			size_type	new_cap = _vgrowth(_size + n);
+			pointer		new_vec = _pallocate(new_cap);
+
+			try {
+				_uninit_copy(first, last, new_vec + pos);
+				_vrelocate_around(new_vec, pos, n);
 			}
 			catch (...) {
-				for (; i != 0; i--)
-					_alloc.destroy(new_vec + i - 1);
 				_alloc.deallocate(new_vec, new_cap);
+				throw;
 			}
-			_vdeallocate();
-			_begin = new_vec; _size = new_size; _cap = new_cap;
+			_vreplace(new_vec, _size + n, new_cap);
 		}
 			// for input_iterator_tag 
 		template <class Iterator>
@@ -450,6 +457,196 @@ namespace ft {
 			for (; first != last; ++first, position++)
 				position = insert(position, *first);
 		}
+		// 8) Insert n copies of val before pos
+		void	_insertfill(size_type pos, size_type n, const value_type& val) {
+			if (n == 0)
+				return ;
+			if (_size + n <= _cap) {
+				value_type	copy(val);
+				pointer		p = _begin + pos;
+				pointer		old_end = _begin + _size;
+				size_type	after = _size - pos;
+
+				if (after > n) {
+					_vmove(old_end - n, old_end, old_end);
+					_size += n;
+					_vshift(p, old_end - n, p + n);
+					ft::fill(p, p + n, copy);
+				}
+				else {
+					_uninit_fill(old_end, n - after, copy);
+					_size += n - after;
+					_vmove(p, old_end, _begin + _size);
+					_size += after;
+					ft::fill(p, old_end, copy);
+				}
+				return ;
+			}
+			_reallocfill(pos, n, val);
+		}
+			// growing path, kept apart so push_back does not need an assignable value_type
+		void	_reallocfill(size_type pos, size_type n, const value_type& val) {
+			size_type	new_cap = _vgrowth(_size + n);
+			pointer		new_vec = _pallocate(new_cap);
+
+			// val may live in the old buffer: the copies are built before anything is moved
+			try {
+				_uninit_fill(new_vec + pos, n, val);
+				_vrelocate_around(new_vec, pos, n);
+			}
+			catch (...) {
+				_alloc.deallocate(new_vec, new_cap);
+				throw;
+			}
+			_vreplace(new_vec, _size + n, new_cap);
+		}
+# if __cplusplus >= 201103L
+		template <class... Args>
+		void	_reallocemplace(size_type pos, Args&&... args) {
+			size_type	new_cap = _vgrowth(_size + 1);
+			pointer		new_vec = _pallocate(new_cap);
+
+			try {
+				_alloc.construct(new_vec + pos, std::forward<Args>(args)...);
+				_vrelocate_around(new_vec, pos, 1);
+			}
+			catch (...) {
+				_alloc.deallocate(new_vec, new_cap);
+				throw;
+			}
+			_vreplace(new_vec, _size + 1, new_cap);
+		}
+# endif
+			// moves the elements into new_vec around the n already built at
+			// new_vec + pos; on failure destroys those n and whatever was moved
+		void	_vrelocate_around(pointer new_vec, size_type pos, size_type n) {
+			bool	prefix = false;
+
+			try {
+				_vmove(_begin, _begin + pos, new_vec);
+				prefix = true;
+				_vmove(_begin + pos, _begin + _size, new_vec + pos + n);
+			}
+			catch (...) {
+				_destroy_range(prefix ? new_vec : new_vec + pos, new_vec + pos + n);
+				throw;
+			}
+		}
+		// 9) Construction helpers: on exception the partially built range is destroyed
+		template <class InputIterator>
+		pointer	_uninit_copy(InputIterator first, InputIterator last, pointer dest) {
+			pointer	cur = dest;
+
+			try {
+				for (; first != last; ++first, ++cur)
+					_alloc.construct(cur, *first);
+			}
+			catch (...) {
+				_destroy_range(dest, cur);
+				throw;
+			}
+			return cur;
+		}
+		pointer	_uninit_fill(pointer dest, size_type n, const value_type& val) {
+			pointer	cur = dest;
+
+			try {
+				for (; n > 0; --n, ++cur)
+					_alloc.construct(cur, val);
+			}
+			catch (...) {
+				_destroy_range(dest, cur);
+				throw;
+			}
+			return cur;
+		}
+		// 10) Element relocation: bulk memcpy/memmove for trivially copyable types,
+		//     no destructor calls for trivially destructible ones
+			// a) copy-constructs [first, last) into raw storage at dest
+		pointer	_vcopy(const_pointer first, const_pointer last, pointer dest) {
+			return _vcopy(first, last, dest, ft::is_trivially_copyable<value_type>());
+		}
+		pointer	_vcopy(const_pointer first, const_pointer last, pointer dest, true_type) {
+			const char*	src = reinterpret_cast<const char*>(first);
+			char*		dst = reinterpret_cast<char*>(dest);
+			size_type	bytes = static_cast<size_type>(last - first) * sizeof(value_type);
+
+			// copied a page at a time: a single huge memcpy into freshly allocated
+			// memory switches to non-temporal stores and is slower for big buffers
+			for (size_type chunk = VECTOR_COPY_BLOCK; bytes != 0; src += chunk, dst += chunk, bytes -= chunk) {
+				if (chunk > bytes)
+					chunk = bytes;
+				std::memcpy(dst, src, chunk);
+			}
+			return dest + (last - first);
+		}
+		pointer	_vcopy(const_pointer first, const_pointer last, pointer dest, false_type) {
+			return _uninit_copy(first, last, dest);
+		}
+			// b) relocates [first, last) into raw storage at dest; with C++11 it
+			//    moves unless the move may throw and T is copyable, so a failed
+			//    reallocation still leaves the old elements intact
+		pointer	_vmove(pointer first, pointer last, pointer dest) {
+# if __cplusplus >= 201103L
+			return _vmove(first, last, dest, ft::is_trivially_copyable<value_type>());
+# else
+			return _vcopy(first, last, dest);
+# endif
+		}
+# if __cplusplus >= 201103L
+		pointer	_vmove(pointer first, pointer last, pointer dest, true_type) {
+			return _vcopy(first, last, dest, true_type());
+		}
+		pointer	_vmove(pointer first, pointer last, pointer dest, false_type) {
+			pointer	cur = dest;
+
+			try {
+				for (; first != last; ++first, ++cur)
+					_alloc.construct(cur, std::move_if_noexcept(*first));
+			}
+			catch (...) {
+				_destroy_range(dest, cur);
+				throw;
+			}
+			return cur;
+		}
+# endif
+			// c) assigns [first, last) over live elements at dest, ranges may overlap
+		pointer	_vshift(pointer first, pointer last, pointer dest) {
+			return _vshift(first, last, dest, ft::is_trivially_copyable<value_type>());
+		}
+		pointer	_vshift(pointer first, pointer last, pointer dest, true_type) {
+			if (first != last)
+				std::memmove(static_cast<void*>(dest), static_cast<const void*>(first),
+							static_cast<size_type>(last - first) * sizeof(value_type));
+			return dest + (last - first);
+		}
+		pointer	_vshift(pointer first, pointer last, pointer dest, false_type) {
+# if __cplusplus >= 201103L
+			if (dest < first)
+				return ft::move(first, last, dest);
+			ft::move_backward(first, last, dest + (last - first));
+# else
+			if (dest < first)
+				return ft::copy(first, last, dest);
+			ft::copy_backward(first, last, dest + (last - first));
+# endif
+			return dest + (last - first);
+		}
+			// d) destroys [first, last)
+		void	_destroy_range(pointer first, pointer last) {
+			_destroy_range(first, last, ft::is_trivially_destructible<value_type>());
+		}
+		void	_destroy_range(pointer, pointer, true_type) { }
+		void	_destroy_range(pointer first, pointer last, false_type) {
+			for (; first != last; ++first)
+				_alloc.destroy(first);
+		}
+		// 11) Releases the current buffer and takes ownership of new_vec
+		void	_vreplace(pointer new_vec, size_type new_size, size_type new_cap) {
+			_vdeallocate();
+			_begin = new_vec; _size = new_size; _cap = new_cap;
+		}
 	}; // vector
 
 	// SWAP (vectors)